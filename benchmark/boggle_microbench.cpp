@@ -0,0 +1,356 @@
+#include "Board.h"
+#include "BoardCorpus.h"
+#include "BoardGenerator.h"
+#include "Trie.h"
+#include "allocation_tracker.h"
+#include "boggle_counters.h"
+#include "boggle_engines.h"
+#include "boggle_parse.h"
+#include "microbench.h"
+#include "word_list.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Options
+{
+    bool quick{false};
+    std::string filter{};
+    std::string jsonPath{};
+    std::string comparePath{};
+    double threshold{0.05};
+    size_t repetitions{0};
+    std::string replayPath{};
+    bool recordedPace{false};
+    std::string engine{"packed"};
+};
+
+void printUsage()
+{
+    std::cout << "Usage: boggle_microbench [--quick] [--filter TEXT] [--repetitions N]\n"
+                 "                         [--json FILE] [--compare BASELINE.json]"
+                 " [--threshold FRACTION]\n"
+                 "  --quick        few repetitions and small boards only (smoke test)\n"
+                 "  --filter       run only the cases whose name contains TEXT\n"
+                 "  --json         write the results as JSON\n"
+                 "  --compare      compare medians against a saved JSON baseline and exit with\n"
+                 "                 status 1 if a case is slower by more than the threshold\n"
+                 "  --threshold    relative slowdown counted as a regression (default 0.05)\n"
+                 "       boggle_microbench --replay CORPUS [--pace max|recorded] [--engine NAME]\n"
+                 "                         [--json FILE] [--compare BASELINE.json]\n"
+                 "  --replay       solve the boards of a corpus (boggle_solver --record) with the\n"
+                 "                 extended word list, reporting the latency of every board\n"
+                 "  --pace         max: back to back (default); recorded: each board at its\n"
+                 "                 timestamp, latency counted from then\n"
+                 "  --engine       solver engine (default packed)\n";
+}
+
+Options parseOptions(int argc, char* argv[])
+{
+    Options options;
+    for (int i{1}; i < argc; i++)
+    {
+        const std::string_view arg{argv[i]};
+        const bool hasValue{i + 1 < argc};
+        if (arg == "--quick")
+        {
+            options.quick = true;
+        }
+        else if (arg == "--filter" && hasValue)
+        {
+            options.filter = argv[++i];
+        }
+        else if (arg == "--json" && hasValue)
+        {
+            options.jsonPath = argv[++i];
+        }
+        else if (arg == "--compare" && hasValue)
+        {
+            options.comparePath = argv[++i];
+        }
+        else if (arg == "--threshold" && hasValue && parseNumber(argv[i + 1], options.threshold))
+        {
+            i++;
+        }
+        else if (arg == "--repetitions" && hasValue
+                 && parseNumber(argv[i + 1], options.repetitions))
+        {
+            i++;
+        }
+        else if (arg == "--replay" && hasValue)
+        {
+            options.replayPath = argv[++i];
+        }
+        else if (arg == "--pace" && hasValue && (argv[i + 1] == std::string_view{"max"}
+                                                 || argv[i + 1] == std::string_view{"recorded"}))
+        {
+            options.recordedPace = argv[++i] == std::string_view{"recorded"};
+        }
+        else if (arg == "--engine" && hasValue)
+        {
+            options.engine = argv[++i];
+        }
+        else
+        {
+            printUsage();
+            std::exit(arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+    }
+    return options;
+}
+
+struct Dictionary
+{
+    std::string name{};
+    std::vector<std::string_view> words{};
+};
+
+// Function to run the solve cases (dictionary build and lookup, every engine on fixed boards)
+void runSolveCases(const Options& options, const MicrobenchConfig& config,
+                   std::vector<MicrobenchResult>& results)
+{
+    const std::vector<Dictionary> dictionaries{
+        {"basic", std::vector<std::string_view>(WORD_LIST.begin(), WORD_LIST.end())},
+        {"extended",
+         std::vector<std::string_view>(EXTENDED_WORD_LIST.begin(), EXTENDED_WORD_LIST.end())}};
+
+    // Fixed seeds, so that every run (and the baseline) solves the same boards
+    std::vector<Board> boards{BoardGenerator{DiceSet::classic4x4, 1}.next(),
+                              BoardGenerator{DiceSet::classic4x4, 16, 16, 2}.next()};
+    if (!options.quick)
+    {
+        boards.push_back(BoardGenerator{DiceSet::classic4x4, 32, 32, 3}.next());
+    }
+
+    auto run = [&](const std::string& name, const std::function<void()>& body)
+    {
+        if (name.find(options.filter) == std::string::npos)
+        {
+            return;
+        }
+        results.push_back(runMicrobench(name, body, config));
+        const auto& result = results.back();
+        std::cout << std::left << std::setw(40) << name << std::right << std::fixed
+                  << std::setprecision(0) << " median " << std::setw(10) << result.medianNs
+                  << " ns  p99 " << std::setw(10) << result.p99Ns << " ns  stddev "
+                  << std::setprecision(1) << std::setw(5)
+                  << 100.0 * result.stddevNs / std::max(result.meanNs, 1.0) << "%\n";
+    };
+
+    for (const auto& dictionary : dictionaries)
+    {
+        run("trie_build/" + dictionary.name,
+            [&dictionary]
+            {
+                Trie wordsTrie{dictionary.words};
+                doNotOptimize(wordsTrie);
+            });
+
+        const Trie wordsTrie{dictionary.words};
+        run("trie_lookup/" + dictionary.name,
+            [&dictionary, &wordsTrie]
+            {
+                for (const auto word : dictionary.words)
+                {
+                    auto found = wordsTrie.contains(word);
+                    doNotOptimize(found);
+                }
+            });
+
+        for (const auto& engine : getSolverEngines())
+        {
+            const BoardSolver solve{engine.prepare(wordsTrie)};
+            for (const auto& board : boards)
+            {
+                const std::string name{"solve/" + std::string(engine.name) + "/"
+                                       + dictionary.name + "/" + std::to_string(board.rows) + "x"
+                                       + std::to_string(board.columns)};
+                run(name,
+                    [&solve, &board]
+                    {
+                        auto words = solve(board);
+                        doNotOptimize(words);
+                    });
+
+                // Counters and allocations of one more (untimed) solve, when the build collects
+                // them
+                if (name.find(options.filter) == std::string::npos)
+                {
+                    continue;
+                }
+                if (solveCountersEnabled)
+                {
+                    resetSolveCounters();
+                    doNotOptimize(solve(board));
+                    std::cout << "    ";
+                    printSolveCounters(std::cout, threadSolveCounters());
+                }
+                if (allocationTrackingEnabled)
+                {
+                    AllocationScope scope;
+                    const auto words = solve(board);
+                    const AllocationStats stats{scope.stats()};
+                    std::cout << "    " << stats.allocations << " allocations, " << stats.bytes
+                              << " bytes per solve (" << words.size() << " words)\n";
+                }
+            }
+        }
+    }
+}
+
+// Replay mode: solve the boards of a corpus back to back, or each at its recorded time
+// The samples are the latencies of the boards: the solve time, plus the time a board waited past
+// its timestamp for the previous ones with --pace recorded
+MicrobenchResult replayCorpus(const Options& options)
+{
+    using Clock = std::chrono::steady_clock;
+    const BoardCorpus corpus{options.replayPath};
+    if (options.recordedPace && !corpus.hasTimestamps())
+    {
+        throw std::runtime_error("Corpus " + options.replayPath + " has no timestamps");
+    }
+    const auto engine = std::find_if(getSolverEngines().begin(), getSolverEngines().end(),
+                                     [&options](const SolverEngine& candidate)
+                                     { return candidate.name == options.engine; });
+    if (engine == getSolverEngines().end() || corpus.size() == 0)
+    {
+        throw std::runtime_error("Unknown engine " + options.engine + " or empty corpus");
+    }
+    const Trie wordsTrie{
+        std::vector<std::string_view>(EXTENDED_WORD_LIST.begin(), EXTENDED_WORD_LIST.end())};
+    const BoardSolver solve{engine->prepare(wordsTrie)};
+
+    std::vector<double> latencies;
+    latencies.reserve(corpus.size());
+    size_t nWords{0};
+    size_t lateBoards{0};
+    Board board;
+    const auto start = Clock::now();
+    for (size_t i{0}; i < corpus.size(); i++)
+    {
+        corpus.decode(i, board);
+        auto ready = Clock::now();
+        if (options.recordedPace)
+        {
+            const auto due = start + std::chrono::nanoseconds(corpus.timestampNs(i));
+            if (ready < due)
+            {
+                std::this_thread::sleep_until(due);
+                ready = Clock::now();
+            }
+            else
+            {
+                lateBoards++;
+            }
+            ready = std::min(ready, due);
+        }
+        nWords += solve(board).size();
+        latencies.push_back(static_cast<double>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - ready).count()));
+    }
+    const double seconds{std::chrono::duration<double>(Clock::now() - start).count()};
+
+    MicrobenchResult result{summarizeMicrobench(
+        "replay/" + options.engine + "/" + (options.recordedPace ? "recorded" : "max"),
+        std::move(latencies))};
+    std::cout << corpus.size() << " boards of " << corpus.rows() << "x" << corpus.columns()
+              << " from " << options.replayPath << " (" << corpus.fileSizeBytes()
+              << " bytes), engine " << options.engine << ", "
+              << (options.recordedPace ? "recorded" : "maximum") << " pace\n"
+              << std::fixed << std::setprecision(0) << static_cast<double>(corpus.size()) / seconds
+              << " boards/s, " << nWords << " words, latency median " << result.medianNs
+              << " ns, p99 " << result.p99Ns << " ns";
+    if (options.recordedPace)
+    {
+        std::cout << ", " << lateBoards << " boards started late";
+    }
+    std::cout << "\n";
+    return result;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const Options options{parseOptions(argc, argv)};
+
+    MicrobenchConfig config;
+    if (options.quick)
+    {
+        config.warmupTime = std::chrono::milliseconds(1);
+        config.minRepetitionTime = std::chrono::milliseconds(1);
+        config.repetitions = 3;
+    }
+    if (options.repetitions > 0)
+    {
+        config.repetitions = options.repetitions;
+    }
+
+    std::vector<MicrobenchResult> results;
+    if (options.replayPath.empty())
+    {
+        runSolveCases(options, config, results);
+    }
+    else
+    {
+        try
+        {
+            results.push_back(replayCorpus(options));
+        }
+        catch (const std::exception& error)
+        {
+            std::cerr << error.what() << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    if (!options.jsonPath.empty())
+    {
+        std::ofstream out(options.jsonPath);
+        writeMicrobenchJson(out, results);
+        std::cout << "\nResults written to " << options.jsonPath << "\n";
+    }
+
+    if (!options.comparePath.empty())
+    {
+        std::vector<MicrobenchComparison> comparisons;
+        try
+        {
+            comparisons = compareMicrobench(readMicrobenchJson(options.comparePath), results,
+                                            options.threshold);
+        }
+        catch (const std::exception& error)
+        {
+            std::cerr << error.what() << "\n";
+            printUsage();
+            return EXIT_FAILURE;
+        }
+
+        size_t nRegressions{0};
+        std::cout << "\nComparison against " << options.comparePath << " (threshold "
+                  << std::setprecision(1) << 100.0 * options.threshold << "%):\n";
+        for (const auto& comparison : comparisons)
+        {
+            std::cout << std::left << std::setw(40) << comparison.name << std::right
+                      << std::showpos << std::setw(8) << 100.0 * comparison.change << std::noshowpos
+                      << "%" << (comparison.regression ? "  REGRESSION" : "") << "\n";
+            nRegressions += comparison.regression ? 1 : 0;
+        }
+        if (nRegressions > 0)
+        {
+            std::cout << nRegressions << " regression(s) found\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,240 @@
+#include "microbench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+std::chrono::nanoseconds timeIterations(const std::function<void()>& body, size_t iterations)
+{
+    const auto start = Clock::now();
+    for (size_t i{0}; i < iterations; i++)
+    {
+        body();
+    }
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+}
+
+// Nearest-rank percentile of sorted values
+double percentile(const std::vector<double>& sortedValues, double fraction)
+{
+    const auto rank = static_cast<size_t>(
+        std::ceil(fraction * static_cast<double>(sortedValues.size())));
+    return sortedValues[std::clamp<size_t>(rank, 1, sortedValues.size()) - 1];
+}
+
+std::string escapeJson(const std::string& text)
+{
+    std::string escaped;
+    for (const char c : text)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped.push_back('\\');
+        }
+        escaped.push_back(c);
+    }
+    return escaped;
+}
+
+// Reads the JSON string starting at the opening quote at text[pos]
+std::string readJsonString(const std::string& text, size_t& pos)
+{
+    std::string value;
+    for (pos++; pos < text.size() && text[pos] != '"'; pos++)
+    {
+        if (text[pos] == '\\' && pos + 1 < text.size())
+        {
+            pos++;
+        }
+        value.push_back(text[pos]);
+    }
+    if (pos == text.size())
+    {
+        throw std::runtime_error("Unterminated string in benchmark JSON");
+    }
+    pos++;
+    return value;
+}
+} // namespace
+
+MicrobenchResult runMicrobench(const std::string& name, const std::function<void()>& body,
+                               const MicrobenchConfig& config)
+{
+    // Warm up, doubling the batch until the warmup time is spent; the last batch also calibrates
+    // the number of iterations per repetition
+    size_t iterations{1};
+    std::chrono::nanoseconds elapsed{timeIterations(body, iterations)};
+    std::chrono::nanoseconds warmedUp{elapsed};
+    while (warmedUp < config.warmupTime || elapsed < config.minRepetitionTime)
+    {
+        if (elapsed < config.minRepetitionTime)
+        {
+            iterations *= 2;
+        }
+        elapsed = timeIterations(body, iterations);
+        warmedUp += elapsed;
+    }
+
+    std::vector<double> samples;
+    samples.reserve(config.repetitions);
+    for (size_t repetition{0}; repetition < config.repetitions; repetition++)
+    {
+        samples.push_back(static_cast<double>(timeIterations(body, iterations).count())
+                          / static_cast<double>(iterations));
+    }
+
+    MicrobenchResult result{summarizeMicrobench(name, std::move(samples))};
+    result.iterationsPerRepetition = iterations;
+    return result;
+}
+
+MicrobenchResult summarizeMicrobench(const std::string& name, std::vector<double> samples)
+{
+    if (samples.empty())
+    {
+        throw std::invalid_argument("Cannot summarize a benchmark without samples");
+    }
+    std::sort(samples.begin(), samples.end());
+
+    MicrobenchResult result;
+    result.name = name;
+    result.repetitions = samples.size();
+    result.iterationsPerRepetition = 1;
+    result.medianNs = percentile(samples, 0.5);
+    result.p99Ns = percentile(samples, 0.99);
+    result.minNs = samples.front();
+    result.meanNs = std::accumulate(samples.begin(), samples.end(), 0.0)
+                    / static_cast<double>(samples.size());
+
+    double squares{0};
+    for (const double sample : samples)
+    {
+        squares += (sample - result.meanNs) * (sample - result.meanNs);
+    }
+    result.stddevNs = samples.size() > 1
+                          ? std::sqrt(squares / static_cast<double>(samples.size() - 1))
+                          : 0.0;
+    return result;
+}
+
+void writeMicrobenchJson(std::ostream& out, const std::vector<MicrobenchResult>& results)
+{
+    out << "{\n  \"benchmarks\": [";
+    for (size_t i{0}; i < results.size(); i++)
+    {
+        const auto& result = results[i];
+        out << (i == 0 ? "\n" : ",\n") << std::fixed << std::setprecision(2) << "    {\"name\": \""
+            << escapeJson(result.name) << "\", \"repetitions\": " << result.repetitions
+            << ", \"iterations\": " << result.iterationsPerRepetition
+            << ", \"median_ns\": " << result.medianNs << ", \"mean_ns\": " << result.meanNs
+            << ", \"p99_ns\": " << result.p99Ns << ", \"min_ns\": " << result.minNs
+            << ", \"stddev_ns\": " << result.stddevNs << "}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+std::vector<MicrobenchResult> readMicrobenchJson(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        throw std::runtime_error("Cannot open benchmark JSON: " + path);
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    const std::string text{buffer.str()};
+
+    // Only the format written by writeMicrobenchJson is supported: flat objects of string and
+    // number values
+    std::vector<MicrobenchResult> results;
+    size_t pos{text.find('[')};
+    if (pos == std::string::npos)
+    {
+        throw std::runtime_error("No benchmark array in " + path);
+    }
+    while ((pos = text.find('{', pos)) != std::string::npos)
+    {
+        MicrobenchResult result;
+        for (pos++; pos < text.size() && text[pos] != '}'; pos++)
+        {
+            if (text[pos] != '"')
+            {
+                continue;
+            }
+            const std::string key{readJsonString(text, pos)};
+            pos = text.find_first_not_of(" :", pos);
+            if (pos == std::string::npos)
+            {
+                break;
+            }
+            if (text[pos] == '"')
+            {
+                const std::string value{readJsonString(text, pos)};
+                if (key == "name")
+                {
+                    result.name = value;
+                }
+            }
+            else if (key == "median_ns")
+            {
+                result.medianNs = std::stod(text.substr(pos, 32));
+            }
+            else if (key == "min_ns")
+            {
+                result.minNs = std::stod(text.substr(pos, 32));
+            }
+            pos = text.find_first_of(",}", pos) - 1;
+        }
+        if (result.name.empty())
+        {
+            throw std::runtime_error("Benchmark without a name in " + path);
+        }
+        results.push_back(result);
+    }
+    return results;
+}
+
+std::vector<MicrobenchComparison> compareMicrobench(const std::vector<MicrobenchResult>& baseline,
+                                                    const std::vector<MicrobenchResult>& results,
+                                                    double threshold)
+{
+    std::unordered_map<std::string, const MicrobenchResult*> baselineByName;
+    for (const auto& result : baseline)
+    {
+        baselineByName[result.name] = &result;
+    }
+
+    std::vector<MicrobenchComparison> comparisons;
+    for (const auto& result : results)
+    {
+        auto it = baselineByName.find(result.name);
+        if (it == baselineByName.end() || it->second->medianNs <= 0)
+        {
+            continue;
+        }
+        const MicrobenchResult& base = *it->second;
+
+        MicrobenchComparison comparison;
+        comparison.name = result.name;
+        comparison.baselineNs = base.medianNs;
+        comparison.currentNs = result.medianNs;
+        comparison.change = result.medianNs / base.medianNs - 1.0;
+
+        // The fastest repetition must be slower too, so that a burst of noise on a busy machine,
+        // which moves the median but rarely the minimum, isn't reported
+        const bool minSlower{base.minNs <= 0 || result.minNs / base.minNs - 1.0 > threshold};
+        comparison.regression = comparison.change > threshold && minSlower;
+        comparisons.push_back(comparison);
+    }
+    return comparisons;
+}
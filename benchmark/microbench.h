@@ -0,0 +1,80 @@
+#ifndef MICROBENCH_H
+#define MICROBENCH_H
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Barrier which forces the compiler to compute value and to assume it is read, so that the
+// benchmarked work cannot be optimized away
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const void* volatile sink;
+    sink = &value;
+#endif
+}
+
+// How a case is measured
+// Every repetition runs the case enough times to last at least minRepetitionTime, after warmup
+// runs lasting at least warmupTime, so that timer resolution and cold caches don't add noise
+struct MicrobenchConfig
+{
+    std::chrono::nanoseconds warmupTime{std::chrono::milliseconds(50)};
+    std::chrono::nanoseconds minRepetitionTime{std::chrono::milliseconds(10)};
+    size_t repetitions{30};
+};
+
+// Statistics of a case over its repetitions, in nanoseconds per run
+struct MicrobenchResult
+{
+    std::string name{};
+    size_t repetitions{0};
+    size_t iterationsPerRepetition{0};
+    double medianNs{0};
+    double meanNs{0};
+    double p99Ns{0};
+    double minNs{0};
+    double stddevNs{0};
+};
+
+// Function to measure one case
+MicrobenchResult runMicrobench(const std::string& name, const std::function<void()>& body,
+                               const MicrobenchConfig& config);
+
+// Function to get the statistics of samples (nanoseconds per run, one run per sample)
+// Throws std::invalid_argument if samples is empty
+MicrobenchResult summarizeMicrobench(const std::string& name, std::vector<double> samples);
+
+// Function to write results as JSON ({"benchmarks": [{"name": ..., "median_ns": ..., ...}]})
+void writeMicrobenchJson(std::ostream& out, const std::vector<MicrobenchResult>& results);
+
+// Function to read the name, median and minimum of every case of a JSON file written by
+// writeMicrobenchJson
+// Throws std::runtime_error if the file can't be read or isn't in that format
+std::vector<MicrobenchResult> readMicrobenchJson(const std::string& path);
+
+// Outcome of comparing a case against its baseline
+struct MicrobenchComparison
+{
+    std::string name{};
+    double baselineNs{0};
+    double currentNs{0};
+    double change{0}; // relative change of the median, e.g. 0.07 is 7% slower
+    bool regression{false};
+};
+
+// Function to compare the medians of results against a baseline
+// A case regresses when both its median and its fastest repetition are more than threshold
+// (relative) slower than in the baseline; cases which are only in one of the two sets are ignored
+std::vector<MicrobenchComparison> compareMicrobench(const std::vector<MicrobenchResult>& baseline,
+                                                    const std::vector<MicrobenchResult>& results,
+                                                    double threshold);
+
+#endif // MICROBENCH_H
@@ -0,0 +1,191 @@
+#include "boggle_engines.h"
+#include "differential_fuzzer.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Options
+{
+    uint64_t seed{1};
+    size_t cases{1000000};
+    size_t threads{std::max(1u, std::thread::hardware_concurrency())};
+    FuzzConfig config{};
+    std::string engineFilter{};
+    std::string outputPath{"boggle_fuzz_failure.txt"};
+    std::string replayPath{};
+};
+
+void printUsage()
+{
+    std::cout << "Usage: boggle_fuzz [--seed N] [--cases N] [--threads N] [--max-side N]\n"
+                 "                   [--engine TEXT] [--output FILE] [--replay FILE]\n"
+                 "  --seed      seed of the generated boards and dictionaries (default 1)\n"
+                 "  --cases     number of cases to check (default 1000000)\n"
+                 "  --threads   worker threads (default: all hardware threads)\n"
+                 "  --max-side  largest number of rows and columns of a board (default 6)\n"
+                 "  --engine    check only the engines whose name contains TEXT\n"
+                 "  --output    file for the minimized failing case\n"
+                 "                (default boggle_fuzz_failure.txt)\n"
+                 "  --replay    check the engines on a case written by a failing run\n";
+}
+
+Options parseOptions(int argc, char* argv[])
+{
+    Options options;
+    for (int i{1}; i < argc; i++)
+    {
+        const std::string_view arg{argv[i]};
+        const bool hasValue{i + 1 < argc};
+        if (arg == "--seed" && hasValue)
+        {
+            options.seed = std::stoull(argv[++i]);
+        }
+        else if (arg == "--cases" && hasValue)
+        {
+            options.cases = std::stoul(argv[++i]);
+        }
+        else if (arg == "--threads" && hasValue)
+        {
+            options.threads = std::stoul(argv[++i]);
+        }
+        else if (arg == "--max-side" && hasValue)
+        {
+            options.config.maxSide = std::max<size_t>(std::stoul(argv[++i]), 1);
+        }
+        else if (arg == "--engine" && hasValue)
+        {
+            options.engineFilter = argv[++i];
+        }
+        else if (arg == "--output" && hasValue)
+        {
+            options.outputPath = argv[++i];
+        }
+        else if (arg == "--replay" && hasValue)
+        {
+            options.replayPath = argv[++i];
+        }
+        else
+        {
+            printUsage();
+            std::exit(arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE);
+        }
+    }
+    return options;
+}
+
+void printWordList(std::string_view label, const std::vector<std::string>& words)
+{
+    if (words.empty())
+    {
+        return;
+    }
+    std::cout << "  " << label << ":";
+    for (const auto& word : words)
+    {
+        std::cout << " " << word;
+    }
+    std::cout << "\n";
+}
+
+void printMismatch(const FuzzMismatch& mismatch)
+{
+    std::cout << "Engine " << mismatch.engine << " disagrees with the reference\n";
+    if (!mismatch.error.empty())
+    {
+        std::cout << "  threw: " << mismatch.error << "\n";
+    }
+    printWordList("missing", mismatch.missing);
+    printWordList("extra", mismatch.extra);
+}
+
+int replay(const Options& options, const std::vector<SolverEngine>& engines)
+{
+    std::ifstream file(options.replayPath);
+    if (!file)
+    {
+        std::cerr << "Cannot open " << options.replayPath << "\n";
+        return EXIT_FAILURE;
+    }
+    const FuzzCase fuzzCase{readFuzzCase(file)};
+
+    bool allMatch{true};
+    for (const auto& engine : engines)
+    {
+        if (const auto mismatch = checkEngine(engine, fuzzCase))
+        {
+            printMismatch(*mismatch);
+            allMatch = false;
+        }
+    }
+    std::cout << (allMatch ? "All engines match the reference\n" : "");
+    return allMatch ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const Options options{parseOptions(argc, argv)};
+
+    std::vector<SolverEngine> engines;
+    for (const auto& engine : getSolverEngines())
+    {
+        if (engine.name.find(options.engineFilter) != std::string_view::npos)
+        {
+            engines.push_back(engine);
+        }
+    }
+    if (engines.empty())
+    {
+        std::cerr << "No engine matches \"" << options.engineFilter << "\"\n";
+        return EXIT_FAILURE;
+    }
+
+    if (!options.replayPath.empty())
+    {
+        return replay(options, engines);
+    }
+
+    std::cout << "Checking " << options.cases << " cases (seed " << options.seed << ", "
+              << options.threads << " threads) against " << engines.size() << " engines\n";
+
+    const auto start = std::chrono::steady_clock::now();
+    const FuzzRunResult result{
+        runDifferentialFuzz(engines, options.config, options.seed, options.cases, options.threads)};
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+
+    std::cout << result.casesRun << " cases in " << std::fixed << std::setprecision(2)
+              << elapsed.count() << " s (" << std::setprecision(0)
+              << static_cast<double>(result.casesRun) / std::max(elapsed.count(), 1e-9)
+              << " cases/s)\n";
+
+    if (!result.failure)
+    {
+        std::cout << "All engines match the reference\n";
+        return EXIT_SUCCESS;
+    }
+
+    const FuzzFailure& failure = *result.failure;
+    std::cout << "Case " << failure.caseIndex << " fails; minimized from "
+              << failure.original.board.rows << "x" << failure.original.board.columns << " and "
+              << failure.original.words.size() << " words to " << failure.minimized.board.rows
+              << "x" << failure.minimized.board.columns << " and "
+              << failure.minimized.words.size() << " words\n";
+    printMismatch(failure.mismatch);
+
+    std::ofstream out(options.outputPath);
+    out << "# boggle_fuzz --seed " << options.seed << ": case " << failure.caseIndex
+        << ", engine " << failure.mismatch.engine << "\n";
+    writeFuzzCase(out, failure.minimized);
+    std::cout << "Minimized case written to " << options.outputPath << " (check it with --replay)\n";
+    return EXIT_FAILURE;
+}
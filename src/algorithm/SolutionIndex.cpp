@@ -0,0 +1,183 @@
+#include "SolutionIndex.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+// Function to turn (cell, word id) pairs into compressed sparse rows: the ids of every cell, in
+// increasing order without duplicates, and the offset of every cell's ids, followed by the end
+void buildCellRows(std::vector<std::pair<uint32_t, uint32_t>>& pairs, size_t cellCount,
+                   std::vector<uint32_t>& starts, std::vector<uint32_t>& ids)
+{
+    std::sort(pairs.begin(), pairs.end());
+    pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+    starts.assign(cellCount + 1, 0);
+    ids.resize(pairs.size());
+    for (size_t i{0}; i < pairs.size(); i++)
+    {
+        starts[pairs[i].first + 1]++;
+        ids[i] = pairs[i].second;
+    }
+    std::partial_sum(starts.begin(), starts.end(), starts.begin());
+}
+
+// Function to get the first id in [first, last) for which below is false (last if none), where
+// below is true for a prefix of the ids
+template <typename Predicate>
+uint32_t partitionPoint(uint32_t first, uint32_t last, Predicate below)
+{
+    while (first < last)
+    {
+        const uint32_t middle{first + (last - first) / 2};
+        if (below(middle))
+        {
+            first = middle + 1;
+        }
+        else
+        {
+            last = middle;
+        }
+    }
+    return first;
+}
+} // namespace
+
+SolutionIndex::SolutionIndex(const Board& board, const std::vector<WordPath>& wordPaths)
+    : m_rows(board.rows), m_columns(board.columns)
+{
+    m_boardLetters.reserve(cellCount());
+    for (size_t r{0}; r < m_rows; r++)
+    {
+        for (size_t c{0}; c < m_columns; c++)
+        {
+            m_boardLetters += board.getLetter(r, c);
+        }
+    }
+
+    // Paths by word; the stable sort keeps the first path found of every word first
+    std::vector<uint32_t> order(wordPaths.size());
+    std::iota(order.begin(), order.end(), 0u);
+    std::stable_sort(order.begin(), order.end(), [&wordPaths](uint32_t left, uint32_t right)
+                     { return wordPaths[left].word < wordPaths[right].word; });
+
+    m_offsets.push_back(0);
+    m_blankOffsets.push_back(0);
+    std::vector<std::pair<uint32_t, uint32_t>> cellPairs;
+    std::vector<std::pair<uint32_t, uint32_t>> startPairs;
+    for (const uint32_t pathIndex : order)
+    {
+        const WordPath& wordPath = wordPaths[pathIndex];
+        if (wordPath.word.empty() || wordPath.cells.size() != wordPath.word.size())
+        {
+            throw std::invalid_argument("Path doesn't match its word: " + wordPath.word);
+        }
+        if (std::any_of(wordPath.cells.begin(), wordPath.cells.end(),
+                        [this](size_t cell) { return cell >= cellCount(); }))
+        {
+            throw std::invalid_argument("Path leaves the board: " + wordPath.word);
+        }
+
+        if (wordCount() == 0 || word(static_cast<uint32_t>(wordCount() - 1)) != wordPath.word)
+        {
+            m_text += wordPath.word;
+            m_paths.insert(m_paths.end(), wordPath.cells.begin(), wordPath.cells.end());
+            m_offsets.push_back(static_cast<uint32_t>(m_text.size()));
+            m_blanks += wordPath.blankLetters;
+            m_blankOffsets.push_back(static_cast<uint32_t>(m_blanks.size()));
+        }
+
+        const auto id = static_cast<uint32_t>(wordCount() - 1);
+        for (const size_t cell : wordPath.cells)
+        {
+            cellPairs.emplace_back(static_cast<uint32_t>(cell), id);
+        }
+        startPairs.emplace_back(static_cast<uint32_t>(wordPath.cells.front()), id);
+    }
+
+    buildCellRows(cellPairs, cellCount(), m_cellStarts, m_cellWords);
+    buildCellRows(startPairs, cellCount(), m_firstStarts, m_firstWords);
+    m_text.shrink_to_fit();
+    m_offsets.shrink_to_fit();
+    m_paths.shrink_to_fit();
+    m_blanks.shrink_to_fit();
+    m_blankOffsets.shrink_to_fit();
+}
+
+SolutionIndex::SolutionIndex(const Trie& wordsTrie, const Board& board)
+    : SolutionIndex(board, findWordPathsInBoard(wordsTrie, board))
+{
+}
+
+uint32_t SolutionIndex::find(std::string_view word) const
+{
+    const auto count = static_cast<uint32_t>(wordCount());
+    const uint32_t id{partitionPoint(0, count, [this, word](uint32_t other)
+                                     { return this->word(other) < word; })};
+    return id < count && this->word(id) == word ? id : noWord;
+}
+
+SolutionIndex::WordRange SolutionIndex::wordsWithPrefix(std::string_view prefix) const
+{
+    // The words with the prefix follow the words which sort before it
+    const uint32_t first{partitionPoint(0, static_cast<uint32_t>(wordCount()),
+                                        [this, prefix](uint32_t id) { return word(id) < prefix; })};
+    const uint32_t last{partitionPoint(first, static_cast<uint32_t>(wordCount()),
+                                       [this, prefix](uint32_t id)
+                                       { return word(id).substr(0, prefix.size()) == prefix; })};
+    return WordRange{first, last};
+}
+
+uint32_t SolutionIndex::findPathWord(std::span<const uint32_t> cells,
+                                     std::string_view blankLetters) const
+{
+    std::string spelled;
+    spelled.reserve(cells.size());
+    size_t blanksUsed{0};
+    for (size_t i{0}; i < cells.size(); i++)
+    {
+        // Cells must be on the board, not repeated, and neighbours: at most one row and one
+        // column apart
+        const uint32_t cell{cells[i]};
+        const auto before = cells.first(i);
+        if (cell >= cellCount() || std::find(before.begin(), before.end(), cell) != before.end())
+        {
+            return noWord;
+        }
+        auto distance = [](size_t a, size_t b) { return a > b ? a - b : b - a; };
+        if (i > 0
+            && (distance(cell / m_columns, cells[i - 1] / m_columns) > 1
+                || distance(cell % m_columns, cells[i - 1] % m_columns) > 1))
+        {
+            return noWord;
+        }
+
+        const char letter{m_boardLetters[cell]};
+        if (letter != wildcardTile)
+        {
+            spelled += letter;
+        }
+        else if (blanksUsed < blankLetters.size())
+        {
+            spelled += blankLetters[blanksUsed++];
+        }
+        else
+        {
+            return noWord;
+        }
+    }
+
+    return blanksUsed == blankLetters.size() ? find(spelled) : noWord;
+}
+
+size_t SolutionIndex::memoryBytes() const
+{
+    return m_boardLetters.capacity() + m_text.capacity() + m_blanks.capacity()
+           + (m_offsets.capacity() + m_paths.capacity() + m_blankOffsets.capacity()
+              + m_cellStarts.capacity() + m_cellWords.capacity() + m_firstStarts.capacity()
+              + m_firstWords.capacity())
+                 * sizeof(uint32_t);
+}
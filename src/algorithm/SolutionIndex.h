@@ -0,0 +1,132 @@
+#ifndef SOLUTIONINDEX_H
+#define SOLUTIONINDEX_H
+
+#include "Board.h"
+#include "Trie.h"
+#include "boggle_algorithm.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Index of the solution of one board, built once from a full solve, for the queries of a live game
+// The distinct words are numbered in lexicographic order and stored back to back, each with one of
+// its paths (the first one found) stored parallel to its letters, and the letters that path gives
+// to its blank tiles. The words using a cell and the words starting at a cell are kept as
+// compressed sparse rows: an offset per cell into one array of word ids. Every query is then a
+// binary search or a slice of an array, without solving the board again or scanning its results.
+// Cells are row-major indices (row * columns + column), like the cells of WordPath.
+class SolutionIndex
+{
+public:
+    static constexpr uint32_t noWord{std::numeric_limits<uint32_t>::max()};
+
+    // Ids first to last - 1 of consecutive words
+    struct WordRange
+    {
+        uint32_t first{0};
+        uint32_t last{0};
+
+        size_t size() const
+        {
+            return last - first;
+        }
+
+        bool empty() const
+        {
+            return first == last;
+        }
+    };
+
+private:
+    size_t m_rows{0};
+    size_t m_columns{0};
+    std::string m_boardLetters{};        // row-major
+    std::string m_text{};                // all words in id order
+    std::vector<uint32_t> m_offsets{};   // start of every word in m_text and m_paths, and its end
+    std::vector<uint32_t> m_paths{};     // cells of one path of every word, parallel to m_text
+    std::string m_blanks{};              // letters of the blanks of every path, in id order
+    std::vector<uint32_t> m_blankOffsets{}; // start of every word in m_blanks, and its end
+    // Words of every cell: ids from m_cellWords[m_cellStarts[cell]] to m_cellStarts[cell + 1] - 1
+    std::vector<uint32_t> m_cellStarts{};
+    std::vector<uint32_t> m_cellWords{}; // words with a path through the cell
+    // Same for the words with a path starting at the cell
+    std::vector<uint32_t> m_firstStarts{};
+    std::vector<uint32_t> m_firstWords{};
+
+public:
+    SolutionIndex() = delete;
+
+    // Constructor indexing wordPaths, the paths found on board by findWordPathsInBoard
+    // Throws std::invalid_argument if a path doesn't fit the board or its word
+    SolutionIndex(const Board& board, const std::vector<WordPath>& wordPaths);
+
+    // Constructor solving board with findWordPathsInBoard
+    SolutionIndex(const Trie& wordsTrie, const Board& board);
+
+    size_t wordCount() const
+    {
+        return m_offsets.size() - 1;
+    }
+
+    size_t cellCount() const
+    {
+        return m_rows * m_columns;
+    }
+
+    // Function to get the word with an id; the view stays valid as long as the index
+    std::string_view word(uint32_t id) const
+    {
+        return std::string_view(m_text).substr(m_offsets[id], m_offsets[id + 1] - m_offsets[id]);
+    }
+
+    // Function to get the cells of a path of the word with an id
+    std::span<const uint32_t> path(uint32_t id) const
+    {
+        return std::span<const uint32_t>(m_paths).subspan(m_offsets[id],
+                                                          m_offsets[id + 1] - m_offsets[id]);
+    }
+
+    // Function to get the letters that the path of the word with an id gives to its blank tiles,
+    // in path order (empty if the path has no blank)
+    std::string_view blankLetters(uint32_t id) const
+    {
+        return std::string_view(m_blanks).substr(m_blankOffsets[id],
+                                                 m_blankOffsets[id + 1] - m_blankOffsets[id]);
+    }
+
+    // Function to get the id of a word (noWord if the board doesn't have it)
+    uint32_t find(std::string_view word) const;
+
+    // Function to get the words starting with prefix (all words for an empty prefix)
+    WordRange wordsWithPrefix(std::string_view prefix) const;
+
+    // Function to get the ids of the words with a path through cell, in increasing order
+    std::span<const uint32_t> wordsThroughCell(size_t cell) const
+    {
+        return std::span<const uint32_t>(m_cellWords)
+            .subspan(m_cellStarts[cell], m_cellStarts[cell + 1] - m_cellStarts[cell]);
+    }
+
+    // Function to get the ids of the words with a path starting at cell, in increasing order
+    std::span<const uint32_t> wordsStartingAt(size_t cell) const
+    {
+        return std::span<const uint32_t>(m_firstWords)
+            .subspan(m_firstStarts[cell], m_firstStarts[cell + 1] - m_firstStarts[cell]);
+    }
+
+    // Function to check a path traced by a player: returns the id of the word it spells, or noWord
+    // unless its cells are distinct neighbours on the board which spell a word of the board
+    // blankLetters are the letters the player gives to the wildcard cells of the path, in order
+    uint32_t findPathWord(std::span<const uint32_t> cells,
+                          std::string_view blankLetters = {}) const;
+
+    // Function to get the bytes used by the index (excluding the object itself)
+    size_t memoryBytes() const;
+};
+
+#endif // SOLUTIONINDEX_H
@@ -0,0 +1,141 @@
+#include "WordIdSet.h"
+
+#include <algorithm>
+#include <bit>
+#include <stdexcept>
+
+WordIdSet::WordIdSet(const WordIndex& dictionary)
+    : m_dictionary(dictionary), m_bits((dictionary.wordCount() + 63) / 64, 0)
+{
+}
+
+void WordIdSet::checkSameDictionary(const WordIdSet& other) const
+{
+    if (&other.dictionary() != &dictionary())
+    {
+        throw std::invalid_argument("Word id sets of different dictionaries can't be combined");
+    }
+}
+
+bool WordIdSet::contains(std::string_view word) const
+{
+    const uint32_t id{dictionary().find(word)};
+    return id != WordIndex::noWord && contains(id);
+}
+
+void WordIdSet::clear()
+{
+    std::fill(m_bits.begin(), m_bits.end(), 0);
+}
+
+size_t WordIdSet::size() const
+{
+    size_t count{0};
+    for (const uint64_t block : m_bits)
+    {
+        count += static_cast<size_t>(std::popcount(block));
+    }
+    return count;
+}
+
+bool WordIdSet::empty() const
+{
+    return std::all_of(m_bits.begin(), m_bits.end(), [](uint64_t block) { return block == 0; });
+}
+
+uint32_t WordIdSet::nextId(uint32_t id) const
+{
+    const auto wordCount = static_cast<uint32_t>(dictionary().wordCount());
+    if (id >= wordCount)
+    {
+        return wordCount;
+    }
+
+    // Bits of the first block below id are masked off; bits past the last word are never set
+    size_t blockIndex{id / 64};
+    uint64_t block{m_bits[blockIndex] & (~uint64_t{0} << (id % 64))};
+    while (block == 0)
+    {
+        if (++blockIndex == m_bits.size())
+        {
+            return wordCount;
+        }
+        block = m_bits[blockIndex];
+    }
+    return static_cast<uint32_t>(blockIndex * 64 + static_cast<size_t>(std::countr_zero(block)));
+}
+
+std::vector<std::string_view> WordIdSet::words() const
+{
+    std::vector<std::string_view> words;
+    words.reserve(size());
+    for (const auto word : *this)
+    {
+        words.push_back(word);
+    }
+    return words;
+}
+
+std::vector<std::string> WordIdSet::toStrings() const
+{
+    std::vector<std::string> words;
+    words.reserve(size());
+    for (const auto word : *this)
+    {
+        words.emplace_back(word);
+    }
+    return words;
+}
+
+WordIdSet& WordIdSet::operator|=(const WordIdSet& other)
+{
+    checkSameDictionary(other);
+    for (size_t i{0}; i < m_bits.size(); i++)
+    {
+        m_bits[i] |= other.m_bits[i];
+    }
+    return *this;
+}
+
+WordIdSet& WordIdSet::operator&=(const WordIdSet& other)
+{
+    checkSameDictionary(other);
+    for (size_t i{0}; i < m_bits.size(); i++)
+    {
+        m_bits[i] &= other.m_bits[i];
+    }
+    return *this;
+}
+
+WordIdSet& WordIdSet::operator-=(const WordIdSet& other)
+{
+    checkSameDictionary(other);
+    for (size_t i{0}; i < m_bits.size(); i++)
+    {
+        m_bits[i] &= ~other.m_bits[i];
+    }
+    return *this;
+}
+
+bool WordIdSet::operator==(const WordIdSet& other) const
+{
+    return &dictionary() == &other.dictionary() && m_bits == other.m_bits;
+}
+
+WordIdSet operator|(WordIdSet left, const WordIdSet& right)
+{
+    left |= right;
+    return left;
+}
+
+WordIdSet operator&(WordIdSet left, const WordIdSet& right)
+{
+    left &= right;
+    return left;
+}
+
+WordIdSet operator-(WordIdSet left, const WordIdSet& right)
+{
+    left -= right;
+    return left;
+}
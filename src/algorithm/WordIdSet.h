@@ -0,0 +1,137 @@
+#ifndef WORDIDSET_H
+#define WORDIDSET_H
+
+#include "WordIndex.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Set of words of a WordIndex, stored as a bitset over the word ids (one bit per dictionary word)
+// Inserting a word is setting a bit, so duplicates cost nothing, and the set operations work a
+// 64-bit block at a time. Iterating yields string_views into the dictionary in lexicographic order,
+// since ids are lexicographic, without copying or sorting strings.
+class WordIdSet
+{
+private:
+    std::reference_wrapper<const WordIndex> m_dictionary;
+    std::vector<uint64_t> m_bits{};
+
+    // Throws std::invalid_argument if other uses another dictionary
+    void checkSameDictionary(const WordIdSet& other) const;
+
+public:
+    // Iterator over the words of the set, in lexicographic order
+    class Iterator
+    {
+    private:
+        std::reference_wrapper<const WordIdSet> m_set;
+        uint32_t m_id{0};
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = std::string_view;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = std::string_view;
+
+        Iterator(const WordIdSet& set, uint32_t id) : m_set(set), m_id(id)
+        {
+        }
+
+        std::string_view operator*() const
+        {
+            return m_set.get().dictionary().word(m_id);
+        }
+
+        // Function to get the word id the iterator is at
+        uint32_t id() const
+        {
+            return m_id;
+        }
+
+        Iterator& operator++()
+        {
+            m_id = m_set.get().nextId(m_id + 1);
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator previous{*this};
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return m_id == other.m_id;
+        }
+    };
+
+    WordIdSet() = delete;
+
+    // Constructor of an empty set of words of dictionary, which must outlive the set
+    explicit WordIdSet(const WordIndex& dictionary);
+
+    const WordIndex& dictionary() const
+    {
+        return m_dictionary.get();
+    }
+
+    void insert(uint32_t id)
+    {
+        m_bits[id / 64] |= uint64_t{1} << (id % 64);
+    }
+
+    bool contains(uint32_t id) const
+    {
+        return (m_bits[id / 64] >> (id % 64) & 1) != 0;
+    }
+
+    // Function to check whether the set contains a word (false if it's not in the dictionary)
+    bool contains(std::string_view word) const;
+
+    void clear();
+
+    // Function to get the number of words (a population count of the bitset)
+    size_t size() const;
+
+    bool empty() const;
+
+    // Function to get the smallest id in the set which is at least id (wordCount() if none)
+    uint32_t nextId(uint32_t id) const;
+
+    Iterator begin() const
+    {
+        return Iterator(*this, nextId(0));
+    }
+
+    Iterator end() const
+    {
+        return Iterator(*this, static_cast<uint32_t>(dictionary().wordCount()));
+    }
+
+    // Function to get the words, in lexicographic order, as views into the dictionary
+    std::vector<std::string_view> words() const;
+
+    // Function to get copies of the words, in lexicographic order
+    std::vector<std::string> toStrings() const;
+
+    // Set operations; both sets must use the same dictionary (std::invalid_argument otherwise)
+    WordIdSet& operator|=(const WordIdSet& other);
+    WordIdSet& operator&=(const WordIdSet& other);
+    WordIdSet& operator-=(const WordIdSet& other);
+
+    bool operator==(const WordIdSet& other) const;
+};
+
+WordIdSet operator|(WordIdSet left, const WordIdSet& right);
+WordIdSet operator&(WordIdSet left, const WordIdSet& right);
+WordIdSet operator-(WordIdSet left, const WordIdSet& right);
+
+#endif // WORDIDSET_H
@@ -3,214 +3,284 @@
 #include "Board.h"
 #include "Trie.h"
 #include "VisitMap.h"
+#include "boggle_counters.h"
+#include "boggle_dictionary.h"
 
 #include <cassert>
-#include <stack>
 #include <string>
 #include <vector>
 
-ContinueTraversing checkBoardIndex(const Trie& wordsTrie, const Board& board,
-                                   const VisitMap& visitMap, const std::string& currentWord, int r,
-                                   int c, std::vector<std::string>& wordsFound)
+namespace
 {
-    // Check bounds
-    if ((r < 0) || (r >= static_cast<int>(board.rows)) || (c < 0)
-        || (c >= static_cast<int>(board.columns)))
+// Function to solve board (a Board or ZOrderBoard) with the recursive or iterative traversal
+template <typename BoardType>
+std::vector<std::string> solveWithTrie(const Trie& wordsTrie, const BoardType& board,
+                                       bool iterative)
+{
+    rejectWildcards(board, iterative ? "iterative" : "recursive");
+
+    const TrieDictionary dictionary{wordsTrie};
+    std::vector<std::string> wordsFound{
+        iterative ? findValidWordsInBoardIterativeWith(dictionary, board)
+                  : findValidWordsInBoardWith(dictionary, board)};
+    BOGGLE_COUNT(duplicates, countDuplicateWords(wordsFound));
+    return wordsFound;
+}
+} // namespace
+
+std::vector<std::string> findValidWordsInBoardRecursive(const Trie& wordsTrie, const Board& board)
+{
+    return solveWithTrie(wordsTrie, board, false);
+}
+
+std::vector<std::string> findValidWordsInBoardRecursive(const Trie& wordsTrie,
+                                                        const ZOrderBoard& board)
+{
+    return solveWithTrie(wordsTrie, board, false);
+}
+
+std::vector<std::string> findValidWordsInBoardIterative(const Trie& wordsTrie, const Board& board)
+{
+    return solveWithTrie(wordsTrie, board, true);
+}
+
+std::vector<std::string> findValidWordsInBoardIterative(const Trie& wordsTrie,
+                                                        const ZOrderBoard& board)
+{
+    return solveWithTrie(wordsTrie, board, true);
+}
+
+namespace
+{
+// Function to extend current with the cell (row, col), reached through child, and go on from there
+void stepWithPath(const Board& board, VisitMap& visitMap, const Node& child, bool blank,
+                  WordPath& current, size_t row, size_t col, std::vector<WordPath>& pathsFound)
+{
+    current.word.push_back(child.getLetter());
+    current.cells.push_back(row * board.columns + col);
+    if (blank)
     {
-        return ContinueTraversing::no;
+        current.blankLetters.push_back(child.getLetter());
     }
-
-    // Skip index if visited
-    if (visitMap.isVisited(static_cast<size_t>(r), static_cast<size_t>(c)))
+    if (child.isValidWord())
     {
-        return ContinueTraversing::no;
+        pathsFound.push_back(current);
     }
 
-    // Get current word + new letter from board index
-    auto currentWordPlusNewLetter{
-        currentWord + board.getLetter(static_cast<size_t>(r), static_cast<size_t>(c))};
-
-    // Check whether word is in Trie and whether it's a valid word
-    auto wordInTrie = wordsTrie.contains(currentWordPlusNewLetter);
+    visitMap.markVisited(row, col);
+    traverseBoardWithPaths(board, visitMap, child, current, static_cast<int>(row),
+                           static_cast<int>(col), pathsFound);
+    visitMap.unmarkVisited(row, col);
 
-    // If it doesn't exist, begin new traversal
-    if (wordInTrie == inTrie::doesntExist)
+    current.word.pop_back();
+    current.cells.pop_back();
+    if (blank)
     {
-        return ContinueTraversing::no;
+        current.blankLetters.pop_back();
     }
+}
 
-    // If it's a word, append to findValidWords
-    if (wordInTrie == inTrie::isWord)
+// Function to step from node into the cell (row, col): into the child of its letter, or into every
+// child at a wildcard cell
+void stepIntoCell(const Board& board, VisitMap& visitMap, const Node& node, WordPath& current,
+                  size_t row, size_t col, std::vector<WordPath>& pathsFound)
+{
+    const char letter{board.getLetter(row, col)};
+    if (letter != wildcardTile)
     {
-        wordsFound.emplace_back(currentWordPlusNewLetter);
+        if (const Node* child = node.findChild(letter))
+        {
+            stepWithPath(board, visitMap, *child, false, current, row, col, pathsFound);
+        }
+        return;
     }
 
-    return ContinueTraversing::yes;
+    for (size_t i{0}; i < node.getNumChildren(); i++)
+    {
+        stepWithPath(board, visitMap, *node.getChildAtIndex(i), true, current, row, col,
+                     pathsFound);
+    }
 }
+} // namespace
 
-void traverseBoardRecursively(const Trie& wordsTrie, const Board& board, VisitMap& visitMap,
-                              const std::string& currentWord, int rStart, int cStart,
-                              std::vector<std::string>& wordsFound)
+void traverseBoardWithPaths(const Board& board, VisitMap& visitMap, const Node& node,
+                            WordPath& current, int rStart, int cStart,
+                            std::vector<WordPath>& pathsFound)
 {
     for (int r{rStart - 1}; r <= rStart + 1; r++)
     {
         for (int c{cStart - 1}; c <= cStart + 1; c++)
         {
-            if (checkBoardIndex(wordsTrie, board, visitMap, currentWord, r, c, wordsFound)
-                == ContinueTraversing::yes)
+            // Check bounds
+            if ((r < 0) || (r >= static_cast<int>(board.rows)) || (c < 0)
+                || (c >= static_cast<int>(board.columns)))
             {
-                // Mark index as visited
-                visitMap.markVisited(static_cast<size_t>(r), static_cast<size_t>(c));
-
-                // Add the letter to the actual word for continuing traversal
-                auto newCurrentWord{
-                    currentWord + board.getLetter(static_cast<size_t>(r), static_cast<size_t>(c))};
+                continue;
+            }
 
-                // Recursive call with the same VisitMap
-                traverseBoardRecursively(wordsTrie, board, visitMap, newCurrentWord, r, c,
-                                         wordsFound);
+            const auto row{static_cast<size_t>(r)};
+            const auto col{static_cast<size_t>(c)};
 
-                // Unmark the cell after returning from recursion
-                visitMap.unmarkVisited(static_cast<size_t>(r), static_cast<size_t>(c));
+            // Skip index if visited
+            if (!visitMap.isVisited(row, col))
+            {
+                stepIntoCell(board, visitMap, node, current, row, col, pathsFound);
             }
         }
     }
 }
 
-std::vector<std::string> findValidWordsInBoardRecursive(const Trie& wordsTrie, const Board& board)
+std::vector<WordPath> findWordPathsInBoard(const Trie& wordsTrie, const Board& board)
 {
-    std::vector<std::string> wordsFound{};
+    std::vector<WordPath> pathsFound{};
+    WordPath current{};
+    VisitMap visitMap(board.rows, board.columns);
 
-    // Important: we're looping over the major dimension first for better memory caching of our
-    // row-major structs
-    for (int r{0}; r < static_cast<int>(board.rows); r++)
+    // Every starting index is checked here, as in findValidWordsInBoardRecursive
+    for (size_t row{0}; row < board.rows; row++)
     {
-        for (int c{0}; c < static_cast<int>(board.columns); c++)
+        for (size_t col{0}; col < board.columns; col++)
         {
-            // Create a single VisitMap for this starting position
-            VisitMap visitMap(board.rows, board.columns);
-
-            std::string currentWord{}; // Store current word (letters for each traversal)
-
-            // Check first index here
-            // This is important because we want the starting index to be exactly the one from this
-            // double-loop and not in the inner traversal loop
-            if (checkBoardIndex(wordsTrie, board, visitMap, currentWord, r, c, wordsFound)
-                == ContinueTraversing::yes)
-            {
-                // Mark index as visited
-                visitMap.markVisited(static_cast<size_t>(r), static_cast<size_t>(c));
-
-                // Add the letter to the actual word for continuing traversal
-                currentWord += board.getLetter(static_cast<size_t>(r), static_cast<size_t>(c));
-
-                // Recursive call with the same VisitMap
-                traverseBoardRecursively(wordsTrie, board, visitMap, currentWord, r, c, wordsFound);
-
-                // No need to unmark here as we're done with this starting position
-            }
+            stepIntoCell(board, visitMap, wordsTrie.getRoot(), current, row, col, pathsFound);
         }
     }
 
-    return wordsFound;
+    return pathsFound;
+}
+
+size_t scoreWordLength(size_t length)
+{
+    constexpr std::array<size_t, 9> pointsByLength{0, 0, 0, 1, 1, 2, 3, 5, 11};
+    return length < pointsByLength.size() ? pointsByLength[length] : pointsByLength.back();
 }
 
-// Helper function to check a position and push new state onto stack if valid
-void pushNewStateIfValid(const Trie& wordsTrie, const Board& board, const std::string& currentWord,
-                         int r, int c, VisitMap& visitMap, std::vector<std::string>& wordsFound,
-                         std::stack<SearchState>& stateStack)
+namespace
 {
-    if (checkBoardIndex(wordsTrie, board, visitMap, currentWord, r, c, wordsFound)
-        == ContinueTraversing::yes)
+// State of a count-only/score-only traversal
+struct TallyTraversal
+{
+    const Board& board;
+    const SolveThreshold& threshold;
+    TallyScratch& scratch;
+    SolveTally tally{};
+
+    // Records the word of node if it's new, returns whether the threshold has been reached
+    bool recordWord(const Node& node)
     {
-        // Mark index as visited
-        visitMap.markVisited(static_cast<size_t>(r), static_cast<size_t>(c));
+        auto& seen = scratch.seenWords[node.getId()];
+        if (seen != 0)
+        {
+            return false;
+        }
+        seen = 1;
 
-        // Add the letter to the actual word for continuing traversal
-        auto newCurrentWord{currentWord
-                            + board.getLetter(static_cast<size_t>(r), static_cast<size_t>(c))};
+        tally.wordCount++;
+        tally.score += scoreWordLength(node.getDepth());
 
-        // Push new state to stack
-        stateStack.push({r, c, 0, newCurrentWord});
+        tally.thresholdReached
+            = (threshold.minWords > 0 && tally.wordCount >= threshold.minWords)
+              || (threshold.minScore > 0 && tally.score >= threshold.minScore);
+        return tally.thresholdReached;
     }
-}
 
-std::vector<std::string> findValidWordsInBoardIterative(const Trie& wordsTrie, const Board& board)
-{
-    std::vector<std::string> wordsFound{};
-
-    // Define the 8 possible directions to traverse from any cell
-    constexpr size_t nDirections = 8;
-    constexpr std::array<std::array<int, 2>, nDirections> directionSteps = {
-        {{-1, -1},
-         {-1, 0},
-         {-1, 1}, // Above cells
-         {0, -1},
-         {0, 1}, // Adjacent cells
-         {1, -1},
-         {1, 0},
-         {1, 1}} // Below cells
-    };
-
-    // Iterate through each cell in the board as a starting position
-    // Important: we're looping over the major dimension first for better memory caching of our
-    // row-major structs
-    for (int rInit{0}; rInit < static_cast<int>(board.rows); rInit++)
+    // Steps from node into the cell (r, c): into the child of its letter, or into every child at
+    // a wildcard cell; returns whether to stop
+    bool step(const Node& node, int r, int c)
     {
-        for (int cInit{0}; cInit < static_cast<int>(board.columns); cInit++)
+        const char letter{board.getLetter(static_cast<size_t>(r), static_cast<size_t>(c))};
+        if (letter != wildcardTile)
         {
-            // Create a single VisitMap for this starting position
-            VisitMap visitMap(board.rows, board.columns);
+            const Node* child = node.findChild(letter);
+            return child && visit(*child, r, c);
+        }
 
-            // Skip invalid starting positions
-            std::string emptyWord{};
-            if (checkBoardIndex(wordsTrie, board, visitMap, emptyWord, rInit, cInit, wordsFound)
-                != ContinueTraversing::yes)
+        for (size_t i{0}; i < node.getNumChildren(); i++)
+        {
+            if (visit(*node.getChildAtIndex(i), r, c))
             {
-                continue;
+                return true;
             }
+        }
+        return false;
+    }
 
-            // Mark initial position as visited
-            visitMap.markVisited(static_cast<size_t>(rInit), static_cast<size_t>(cInit));
-
-            // Initial letter for the current word
-            std::string initialLetter(
-                1, board.getLetter(static_cast<size_t>(rInit), static_cast<size_t>(cInit)));
-
-            // Initialize a single stack for DFS traversal
-            std::stack<SearchState> stateStack;
+    // Visits the cell (r, c), reached through node, returns whether to stop
+    bool visit(const Node& node, int r, int c)
+    {
+        if (node.isValidWord() && recordWord(node))
+        {
+            return true;
+        }
 
-            // Push initial state
-            stateStack.push({rInit, cInit, 0, initialLetter});
+        const size_t cell{static_cast<size_t>(r) * board.columns + static_cast<size_t>(c)};
+        scratch.visited[cell] = 1;
 
-            // DFS traversal
-            while (!stateStack.empty())
+        bool stop{false};
+        for (int nextR{r - 1}; nextR <= r + 1 && !stop; nextR++)
+        {
+            for (int nextC{c - 1}; nextC <= c + 1 && !stop; nextC++)
             {
-                // Get current state - use reference to avoid copying
-                SearchState& currentState = stateStack.top();
-
-                // If all directions from current cell are explored, backtrack
-                if (currentState.directionIndex >= nDirections)
+                if ((nextR < 0) || (nextR >= static_cast<int>(board.rows)) || (nextC < 0)
+                    || (nextC >= static_cast<int>(board.columns)))
                 {
-                    // Unmark the current cell before popping
-                    visitMap.unmarkVisited(static_cast<size_t>(currentState.r),
-                                           static_cast<size_t>(currentState.c));
-
-                    stateStack.pop();
                     continue;
                 }
 
-                // Get next direction to explore
-                size_t dirIndex = currentState.directionIndex++;
-                int newR = currentState.r + directionSteps[dirIndex][0];
-                int newC = currentState.c + directionSteps[dirIndex][1];
+                const size_t nextCell{static_cast<size_t>(nextR) * board.columns
+                                      + static_cast<size_t>(nextC)};
+                if (scratch.visited[nextCell] == 0)
+                {
+                    stop = step(node, nextR, nextC);
+                }
+            }
+        }
+
+        scratch.visited[cell] = 0;
+        return stop;
+    }
+};
+} // namespace
+
+SolveTally tallyValidWordsInBoard(const Trie& wordsTrie, const Board& board,
+                                  const SolveThreshold& threshold, TallyScratch& scratch)
+{
+    scratch.visited.assign(board.rows * board.columns, 0);
+    scratch.seenWords.assign(wordsTrie.getNodeCount(), 0);
 
-                // Try to move in the current direction
-                pushNewStateIfValid(wordsTrie, board, currentState.currentWord, newR, newC,
-                                    visitMap, wordsFound, stateStack);
+    TallyTraversal traversal{board, threshold, scratch};
+    for (int r{0}; r < static_cast<int>(board.rows); r++)
+    {
+        for (int c{0}; c < static_cast<int>(board.columns); c++)
+        {
+            if (traversal.step(wordsTrie.getRoot(), r, c))
+            {
+                return traversal.tally;
             }
         }
     }
 
-    return wordsFound;
+    return traversal.tally;
+}
+
+SolveTally tallyValidWordsInBoard(const Trie& wordsTrie, const Board& board,
+                                  const SolveThreshold& threshold)
+{
+    TallyScratch scratch;
+    return tallyValidWordsInBoard(wordsTrie, board, threshold, scratch);
+}
+
+size_t countValidWordsInBoard(const Trie& wordsTrie, const Board& board)
+{
+    return tallyValidWordsInBoard(wordsTrie, board).wordCount;
+}
+
+size_t scoreValidWordsInBoard(const Trie& wordsTrie, const Board& board)
+{
+    return tallyValidWordsInBoard(wordsTrie, board).score;
+}
+
+bool boardReachesThreshold(const Trie& wordsTrie, const Board& board,
+                           const SolveThreshold& threshold)
+{
+    return tallyValidWordsInBoard(wordsTrie, board, threshold).thresholdReached;
 }
@@ -4,49 +4,100 @@
 #include "Board.h"
 #include "Trie.h"
 #include "VisitMap.h"
+#include "ZOrderBoard.h"
 
-#include <stack>
+#include <cstdint>
 #include <string>
 #include <vector>
 
-enum ContinueTraversing
+// A found word together with the board cells (row-major indices) that spell it, in order
+struct WordPath
 {
-    yes,
-    no
+    std::string word;
+    std::vector<size_t> cells;
+    std::string blankLetters{}; // letters taken by the wildcard cells of the path, in path order
 };
 
-// Function to check whether a board index letter, appended to current word, exists (and is a word)
-// in the words Trie It also checks whether it has been visited before
-ContinueTraversing checkBoardIndex(const Trie& wordsTrie, const Board& board,
-                                   const VisitMap& visitMap, const std::string& currentWord, int r,
-                                   int c, std::vector<std::string>& wordsFound);
-
-// Recursion function to traverse adjacent index in board
-// while the Trie contains the current word
-// Important: currentWord is a new copy, because we take a path which we do not want to be alter the
-// original word (which also takes other paths)
-void traverseBoardRecursively(const Trie& wordsTrie, const Board& board, VisitMap& visitMap,
-                              const std::string& currentWord, int rStart, int cStart,
-                              std::vector<std::string>& wordsFound);
-
-// Define the search state structure for the iterative version
-struct SearchState
-{
-    int r, c;
-    size_t directionIndex;
-    std::string currentWord;
-};
+// Recursion function to traverse the board from node, recording the path of every word found
+// It follows the children of node, the trie node of current.word, so a wildcard cell (wildcardTile)
+// is tried with the letter of every child in one pass. current is restored before returning.
+void traverseBoardWithPaths(const Board& board, VisitMap& visitMap, const Node& node,
+                            WordPath& current, int rStart, int cStart,
+                            std::vector<WordPath>& pathsFound);
 
-// Helper function to check a position and push new state onto stack if valid
-void pushNewStateIfValid(const Trie& wordsTrie, const Board& board, const std::string& currentWord,
-                         int r, int c, VisitMap& visitMap, std::vector<std::string>& wordsFound,
-                         std::stack<SearchState>& stateStack);
+// Main function to find valid words in board together with the cells of each word
+// Words are reported once per path (and assignment of letters to the wildcard cells of the path),
+// in the same order as findValidWordsInBoardRecursive
+std::vector<WordPath> findWordPathsInBoard(const Trie& wordsTrie, const Board& board);
 
 // Main function to find valid words in board using recursion
+// It walks the trie node by node with findValidWordsInBoardWith on a TrieDictionary (see
+// boggle_dictionary.h); words are found in the same order as by findValidWordsInBoardIterative
+// Throws std::invalid_argument if board has a blank tile (wildcardTile)
 std::vector<std::string> findValidWordsInBoardRecursive(const Trie& wordsTrie, const Board& board);
 
+// Overload for a board in Z-order; same results, in the same order, as for the row-major board
+std::vector<std::string> findValidWordsInBoardRecursive(const Trie& wordsTrie,
+                                                        const ZOrderBoard& board);
+
 // Main function to find valid words in board using iteration
-// Uses a single stack of SearchState objects and a shared VisitMap for efficient traversal
+// Uses a single stack of SearchState objects instead of recursion, with
+// findValidWordsInBoardIterativeWith on a TrieDictionary (see boggle_dictionary.h)
+// Throws std::invalid_argument if board has a blank tile (wildcardTile)
 std::vector<std::string> findValidWordsInBoardIterative(const Trie& wordsTrie, const Board& board);
 
+// Overload for a board in Z-order; same results, in the same order, as for the row-major board
+std::vector<std::string> findValidWordsInBoardIterative(const Trie& wordsTrie,
+                                                        const ZOrderBoard& board);
+
+// Function to get the points of a word under standard Boggle scoring
+// (3-4 letters: 1, 5: 2, 6: 3, 7: 5, 8 or more: 11; shorter words score nothing)
+size_t scoreWordLength(size_t length);
+
+// Targets at which a tally stops early; 0 means no target
+// The tally stops as soon as either target is reached
+struct SolveThreshold
+{
+    size_t minWords{0};
+    size_t minScore{0};
+};
+
+// Result of a count-only/score-only solve
+// Every distinct word is counted (and scored) once, however many paths spell it
+struct SolveTally
+{
+    size_t wordCount{0};
+    size_t score{0};
+    bool thresholdReached{false};
+};
+
+// Scratch buffers of a tally, which can be reused between solves to avoid allocating
+struct TallyScratch
+{
+    std::vector<uint8_t> visited{};   // per board cell
+    std::vector<uint8_t> seenWords{}; // per trie node id
+};
+
+// Main function to count and score the distinct valid words in board
+// The trie is walked node by node, so no strings are built and nothing is allocated per word; a
+// wildcard cell steps into every child of the node
+// With a threshold, the traversal stops as soon as the threshold is reached (the tally then only
+// covers the words found so far)
+SolveTally tallyValidWordsInBoard(const Trie& wordsTrie, const Board& board,
+                                  const SolveThreshold& threshold = {});
+
+// Overload reusing the buffers of scratch (sized on first use)
+SolveTally tallyValidWordsInBoard(const Trie& wordsTrie, const Board& board,
+                                  const SolveThreshold& threshold, TallyScratch& scratch);
+
+// Count-only solve: number of distinct valid words in board
+size_t countValidWordsInBoard(const Trie& wordsTrie, const Board& board);
+
+// Score-only solve: total score of the distinct valid words in board
+size_t scoreValidWordsInBoard(const Trie& wordsTrie, const Board& board);
+
+// Threshold solve: whether board has at least threshold.minWords words or threshold.minScore points
+bool boardReachesThreshold(const Trie& wordsTrie, const Board& board,
+                           const SolveThreshold& threshold);
+
 #endif // BOGGLE_ALGORITHM_H
@@ -0,0 +1,224 @@
+#include "boggle_anytime.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+uint32_t countWordsBelow(const Node& node, std::vector<uint32_t>& wordsBelow)
+{
+    uint32_t count{node.isValidWord() ? 1u : 0u};
+    for (size_t i{0}; i < node.getNumChildren(); i++)
+    {
+        count += countWordsBelow(*node.getChildAtIndex(i), wordsBelow);
+    }
+    wordsBelow[node.getId()] = count;
+    return count;
+}
+
+struct AnytimeTraversal
+{
+    const Board& board;
+    const SolveOptions& options;
+    PartialSolveResult& result;
+    std::vector<uint8_t> visited{};
+    std::vector<uint8_t> seenWords{}; // by node id
+    std::string currentWord{};
+    size_t untilCheck{0};
+    bool stopped{false};
+
+    // Checks the limits once every checkInterval expansions
+    bool shouldStop()
+    {
+        if (untilCheck-- > 0)
+        {
+            return false;
+        }
+        untilCheck = options.checkInterval;
+        stopped = options.stopToken.stop_requested()
+                  || std::chrono::steady_clock::now() >= options.deadline;
+        return stopped;
+    }
+
+    void visit(const Node& node, size_t r, size_t c)
+    {
+        if (stopped || shouldStop())
+        {
+            return;
+        }
+        result.expansions++;
+
+        const size_t cell{r * board.columns + c};
+        currentWord.push_back(board.getLetter(r, c));
+        if (node.isValidWord() && seenWords[node.getId()] == 0)
+        {
+            seenWords[node.getId()] = 1;
+            result.words.push_back(currentWord);
+        }
+        visited[cell] = 1;
+
+        const size_t rBegin{r > 0 ? r - 1 : 0};
+        const size_t cBegin{c > 0 ? c - 1 : 0};
+        const size_t rEnd{r + 1 < board.rows ? r + 1 : r};
+        const size_t cEnd{c + 1 < board.columns ? c + 1 : c};
+        for (size_t nextR{rBegin}; nextR <= rEnd && !stopped; nextR++)
+        {
+            for (size_t nextC{cBegin}; nextC <= cEnd && !stopped; nextC++)
+            {
+                if (visited[nextR * board.columns + nextC] != 0)
+                {
+                    continue;
+                }
+
+                const Node* child = node.findChild(board.getLetter(nextR, nextC));
+                if (child)
+                {
+                    visit(*child, nextR, nextC);
+                }
+            }
+        }
+
+        visited[cell] = 0;
+        currentWord.pop_back();
+    }
+};
+} // namespace
+
+AnytimeSolver::AnytimeSolver(const Trie& wordsTrie) : m_wordsTrie(wordsTrie)
+{
+    m_wordsBelow.assign(wordsTrie.getNodeCount(), 0);
+    countWordsBelow(wordsTrie.getRoot(), m_wordsBelow);
+
+    // Letters which start words first, then the letters only found further in words
+    const Node& root = wordsTrie.getRoot();
+    for (size_t i{0}; i < root.getNumChildren(); i++)
+    {
+        const auto letter{static_cast<unsigned char>(root.getChildAtIndex(i)->getLetter())};
+        m_letterIndex[letter] = static_cast<uint16_t>(++m_nLetters);
+    }
+    m_nFirstLetters = m_nLetters;
+    std::vector<const Node*> stack{&root};
+    while (!stack.empty())
+    {
+        const Node* node = stack.back();
+        stack.pop_back();
+        for (size_t i{0}; i < node->getNumChildren(); i++)
+        {
+            const Node* child = node->getChildAtIndex(i);
+            const auto letter{static_cast<unsigned char>(child->getLetter())};
+            if (m_letterIndex[letter] == 0)
+            {
+                m_letterIndex[letter] = static_cast<uint16_t>(++m_nLetters);
+            }
+            stack.push_back(child);
+        }
+    }
+
+    // Words below every two-letter prefix
+    m_pairWords.assign(m_nFirstLetters * m_nLetters, 0);
+    for (size_t i{0}; i < root.getNumChildren(); i++)
+    {
+        const Node& first = *root.getChildAtIndex(i);
+        for (size_t j{0}; j < first.getNumChildren(); j++)
+        {
+            const Node& second = *first.getChildAtIndex(j);
+            const uint16_t secondIndex{m_letterIndex[static_cast<unsigned char>(second.getLetter())]};
+            if (secondIndex != 0)
+            {
+                m_pairWords[i * m_nLetters + secondIndex - 1u] = wordsBelow(second);
+            }
+        }
+    }
+}
+
+std::vector<size_t> AnytimeSolver::rankStartCells(const Board& board, bool promisingFirst) const
+{
+    // Cells are ranked by the bit width of their score (a counting sort into 33 buckets, so that
+    // ranking stays linear in the number of cells); ties keep row-major order
+    constexpr size_t nBuckets{33};
+    std::vector<size_t> cells;
+    std::vector<uint8_t> buckets;
+    cells.reserve(board.rows * board.columns);
+    buckets.reserve(board.rows * board.columns);
+    std::array<size_t, nBuckets + 1> bucketStarts{};
+
+    for (size_t r{0}; r < board.rows; r++)
+    {
+        for (size_t c{0}; c < board.columns; c++)
+        {
+            const uint16_t first{m_letterIndex[static_cast<unsigned char>(board.getLetter(r, c))]};
+            if (first == 0 || first > m_nFirstLetters)
+            {
+                continue;
+            }
+            cells.push_back(r * board.columns + c);
+            if (!promisingFirst)
+            {
+                continue;
+            }
+
+            // Words reachable through the two-letter prefixes this cell starts
+            const uint32_t* pairWords{&m_pairWords[(first - 1u) * m_nLetters]};
+            uint32_t score{0};
+            for (size_t nextR{r > 0 ? r - 1 : 0}; nextR <= std::min(r + 1, board.rows - 1); nextR++)
+            {
+                for (size_t nextC{c > 0 ? c - 1 : 0}; nextC <= std::min(c + 1, board.columns - 1);
+                     nextC++)
+                {
+                    const uint16_t second{
+                        m_letterIndex[static_cast<unsigned char>(board.getLetter(nextR, nextC))]};
+                    if (second != 0 && (nextR != r || nextC != c))
+                    {
+                        score += pairWords[second - 1u];
+                    }
+                }
+            }
+
+            // Highest scores in bucket 0
+            const auto bucket{static_cast<uint8_t>(nBuckets - 1 - std::bit_width(score))};
+            buckets.push_back(bucket);
+            bucketStarts[bucket + 1u]++;
+        }
+    }
+
+    if (!promisingFirst)
+    {
+        return cells;
+    }
+
+    for (size_t bucket{1}; bucket <= nBuckets; bucket++)
+    {
+        bucketStarts[bucket] += bucketStarts[bucket - 1];
+    }
+    std::vector<size_t> ranked(cells.size());
+    for (size_t i{0}; i < cells.size(); i++)
+    {
+        ranked[bucketStarts[buckets[i]]++] = cells[i];
+    }
+    return ranked;
+}
+
+PartialSolveResult AnytimeSolver::solve(const Board& board, const SolveOptions& options) const
+{
+    rejectWildcards(board, "anytime");
+
+    PartialSolveResult result;
+    AnytimeTraversal traversal{board, options, result};
+    traversal.visited.assign(board.rows * board.columns, 0);
+    traversal.seenWords.assign(m_wordsTrie.getNodeCount(), 0);
+
+    for (const size_t cell : rankStartCells(board, options.promisingStartsFirst))
+    {
+        const size_t r{cell / board.columns};
+        const size_t c{cell % board.columns};
+        traversal.visit(*m_wordsTrie.getRoot().findChild(board.getLetter(r, c)), r, c);
+        if (traversal.stopped)
+        {
+            return result;
+        }
+        result.startCellsSearched++;
+    }
+
+    result.complete = true;
+    return result;
+}
@@ -0,0 +1,71 @@
+#ifndef BOGGLE_ANYTIME_H
+#define BOGGLE_ANYTIME_H
+
+#include "Board.h"
+#include "Trie.h"
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <stop_token>
+#include <string>
+#include <vector>
+
+// Limits of an anytime solve
+// The traversal checks the deadline and the stop token every checkInterval cell expansions, so
+// the check costs next to nothing and a solve overshoots its deadline by at most one interval.
+struct SolveOptions
+{
+    std::chrono::steady_clock::time_point deadline{std::chrono::steady_clock::time_point::max()};
+    std::stop_token stopToken{};
+    size_t checkInterval{256};
+    bool promisingStartsFirst{true}; // visit the start cells with the most reachable words first
+};
+
+// Words found by an anytime solve, and whether the solve ran to completion
+struct PartialSolveResult
+{
+    std::vector<std::string> words{}; // distinct words, in the order they were found
+    bool complete{false};
+    size_t startCellsSearched{0};     // start cells whose search finished
+    size_t expansions{0};
+};
+
+// Solver which can be stopped by a deadline or a stop token, returning the words found so far
+// It is prepared once per dictionary: it counts the words below every trie node, to rank start
+// cells by the number of words that their first two letters lead to, and keeps these counts in a
+// table by letter pair so that ranking a board takes a table lookup per neighbour.
+class AnytimeSolver
+{
+private:
+    const Trie& m_wordsTrie;
+    std::vector<uint32_t> m_wordsBelow{}; // by node id, words in the subtree of the node
+    std::array<uint16_t, 256> m_letterIndex{}; // 1 + index of each letter of the words, 0: none
+    size_t m_nFirstLetters{0};                 // letters which start words have the first indices
+    size_t m_nLetters{0};
+    std::vector<uint32_t> m_pairWords{}; // words starting with a letter pair, by letter indices
+
+public:
+    AnytimeSolver() = delete;
+
+    // The solver keeps a reference to wordsTrie, which must outlive it
+    explicit AnytimeSolver(const Trie& wordsTrie);
+
+    // Function to get the number of words in the subtree of a node (the node included)
+    uint32_t wordsBelow(const Node& node) const
+    {
+        return m_wordsBelow[node.getId()];
+    }
+
+    // Function to get the start cells (row-major indices) in the order a solve visits them
+    // Cells whose letter starts no word are left out
+    std::vector<size_t> rankStartCells(const Board& board, bool promisingFirst = true) const;
+
+    // Main function to find the distinct valid words in board until done, the deadline passes or
+    // a stop is requested. Without limits it finds the same words as findValidWordsInBoardRecursive.
+    // Throws std::invalid_argument if board has a blank tile (wildcardTile)
+    PartialSolveResult solve(const Board& board, const SolveOptions& options = {}) const;
+};
+
+#endif // BOGGLE_ANYTIME_H
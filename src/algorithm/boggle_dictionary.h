@@ -0,0 +1,335 @@
+#ifndef BOGGLE_DICTIONARY_H
+#define BOGGLE_DICTIONARY_H
+
+#include "Board.h"
+#include "PackedTrie.h"
+#include "PerfectHashDictionary.h"
+#include "Trie.h"
+#include "TrieTable.h"
+#include "boggle_counters.h"
+
+#include <array>
+#include <concepts>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// A dictionary walked letter by letter, which the templated solvers below accept
+// A state stands for a prefix: start() is the empty prefix and step(state, letter) appends letter.
+// Once no word starts with the prefix, isPrefix is false, and stepping a dead state keeps it dead.
+// isWord tells whether the prefix is a word itself.
+// The recursive and iterative solvers are findValidWordsInBoardWith and
+// findValidWordsInBoardIterativeWith on a TrieDictionary, so a new backend gets both without a
+// traversal of its own. The other solvers rely on more than one letter at a time:
+// - packed, tally and the path solves expand a blank into every child, which step can't enumerate
+// - memoized, anytime and word-ids keep per-solve tables indexed by node or word id
+// - interleaved and level-sync prefetch and sort by the position of packed nodes in memory
+// - multi-list keeps a mask of word lists per node, and lockstep steps TrieTable rows in vectors
+// - word-driven checks whole words on the board without walking prefixes
+template <typename Dictionary>
+concept BoggleDictionary
+    = std::copyable<typename Dictionary::State>
+      && requires(const Dictionary& dictionary, const typename Dictionary::State& state,
+                  char letter) {
+             { dictionary.start() } -> std::same_as<typename Dictionary::State>;
+             { dictionary.step(state, letter) } -> std::same_as<typename Dictionary::State>;
+             { dictionary.isWord(state) } -> std::same_as<bool>;
+             { dictionary.isPrefix(state) } -> std::same_as<bool>;
+         };
+
+// Trie as a BoggleDictionary: the state is a node (nullptr once dead)
+class TrieDictionary
+{
+private:
+    const Trie& m_trie;
+
+public:
+    using State = const Node*;
+
+    explicit TrieDictionary(const Trie& wordsTrie) : m_trie(wordsTrie)
+    {
+    }
+
+    State start() const
+    {
+        return &m_trie.getRoot();
+    }
+
+    State step(State state, char letter) const
+    {
+        return state ? state->findChild(letter) : nullptr;
+    }
+
+    bool isWord(State state) const
+    {
+        return state && state->isValidWord();
+    }
+
+    bool isPrefix(State state) const
+    {
+        return state != nullptr;
+    }
+};
+
+// TrieTable as a BoggleDictionary: the state is a row (TrieTable::deadState once dead)
+class TrieTableDictionary
+{
+private:
+    const TrieTable& m_table;
+
+public:
+    using State = uint32_t;
+
+    explicit TrieTableDictionary(const TrieTable& wordsTable) : m_table(wordsTable)
+    {
+    }
+
+    State start() const
+    {
+        return TrieTable::rootState;
+    }
+
+    State step(State state, char letter) const
+    {
+        return m_table.step(state, letter);
+    }
+
+    bool isWord(State state) const
+    {
+        return m_table.isWord(state);
+    }
+
+    bool isPrefix(State state) const
+    {
+        return state != TrieTable::deadState;
+    }
+};
+
+// PackedTrie as a BoggleDictionary: the state is a packed node (PackedTrie::noNode once dead)
+class PackedTrieDictionary
+{
+private:
+    const PackedTrie& m_trie;
+
+public:
+    using State = uint32_t;
+
+    explicit PackedTrieDictionary(const PackedTrie& wordsTrie) : m_trie(wordsTrie)
+    {
+    }
+
+    State start() const
+    {
+        return PackedTrie::rootIndex;
+    }
+
+    State step(State state, char letter) const
+    {
+        return state == PackedTrie::noNode ? PackedTrie::noNode : m_trie.findChild(state, letter);
+    }
+
+    bool isWord(State state) const
+    {
+        return state != PackedTrie::noNode && m_trie.isWord(state);
+    }
+
+    bool isPrefix(State state) const
+    {
+        return state != PackedTrie::noNode;
+    }
+};
+
+static_assert(BoggleDictionary<TrieDictionary>);
+static_assert(BoggleDictionary<TrieTableDictionary>);
+static_assert(BoggleDictionary<PackedTrieDictionary>);
+static_assert(BoggleDictionary<PerfectHashDictionary>);
+
+// Recursion function to traverse the board from (r, c) with any BoggleDictionary
+// state is the prefix without the letter of (r, c); currentWord and visited are shared buffers
+// which are restored before returning
+// Neighbours are visited row by row, as by findValidWordsInBoardIterativeWith
+// BoardType is Board or ZOrderBoard; the visit flags are row-major for both
+template <BoggleDictionary Dictionary, typename BoardType>
+void traverseBoardWith(const Dictionary& dictionary, const BoardType& board,
+                       const typename Dictionary::State& state, size_t r, size_t c,
+                       std::vector<uint8_t>& visited, std::string& currentWord,
+                       std::vector<std::string>& wordsFound)
+{
+    const char letter{board.getLetter(r, c)};
+    const typename Dictionary::State next{dictionary.step(state, letter)};
+    BOGGLE_COUNT(trieSteps, 1);
+    if (!dictionary.isPrefix(next))
+    {
+        BOGGLE_COUNT(prefixRejections, 1);
+        return;
+    }
+
+    const size_t cell{r * board.columns + c};
+    currentWord.push_back(letter);
+    if (dictionary.isWord(next))
+    {
+        BOGGLE_COUNT(wordsEmitted, 1);
+        wordsFound.push_back(currentWord);
+    }
+    BOGGLE_COUNT(cellsExpanded, 1);
+    BOGGLE_COUNT_MAX(maxDepth, currentWord.size());
+    visited[cell] = 1;
+
+    const size_t rBegin{r > 0 ? r - 1 : 0};
+    const size_t cBegin{c > 0 ? c - 1 : 0};
+    const size_t rEnd{r + 1 < board.rows ? r + 1 : r};
+    const size_t cEnd{c + 1 < board.columns ? c + 1 : c};
+    for (size_t nextR{rBegin}; nextR <= rEnd; nextR++)
+    {
+        for (size_t nextC{cBegin}; nextC <= cEnd; nextC++)
+        {
+            if (visited[nextR * board.columns + nextC] == 0)
+            {
+                traverseBoardWith(dictionary, board, next, nextR, nextC, visited, currentWord,
+                                  wordsFound);
+            }
+        }
+    }
+
+    visited[cell] = 0;
+    currentWord.pop_back();
+}
+
+// Main function to find valid words in board with any BoggleDictionary
+// Every starting cell is tried in row-major order; words are reported once per path
+// BoardType is Board or ZOrderBoard, with the same results
+// Throws std::invalid_argument if board has a blank tile (wildcardTile)
+template <BoggleDictionary Dictionary, typename BoardType>
+std::vector<std::string> findValidWordsInBoardWith(const Dictionary& dictionary,
+                                                   const BoardType& board)
+{
+    rejectWildcards(board, "BoggleDictionary");
+
+    std::vector<std::string> wordsFound{};
+    std::vector<uint8_t> visited(board.rows * board.columns, 0);
+    std::string currentWord{};
+    const typename Dictionary::State root{dictionary.start()};
+    for (size_t r{0}; r < board.rows; r++)
+    {
+        for (size_t c{0}; c < board.columns; c++)
+        {
+            traverseBoardWith(dictionary, board, root, r, c, visited, currentWord, wordsFound);
+        }
+    }
+    return wordsFound;
+}
+
+// Step of the iterative traversal: a cell of the current path, the dictionary state of the path up
+// to the cell and the next of its 8 neighbours to try
+template <BoggleDictionary Dictionary>
+struct SearchState
+{
+    size_t r{0};
+    size_t c{0};
+    size_t directionIndex{0};
+    typename Dictionary::State state{};
+};
+
+// Main function to find valid words in board with any BoggleDictionary, using iteration
+// An explicit stack of SearchState replaces the recursion of findValidWordsInBoardWith; the
+// results are the same, in the same order
+// BoardType is Board or ZOrderBoard, with the same results
+// Throws std::invalid_argument if board has a blank tile (wildcardTile)
+template <BoggleDictionary Dictionary, typename BoardType>
+std::vector<std::string> findValidWordsInBoardIterativeWith(const Dictionary& dictionary,
+                                                            const BoardType& board)
+{
+    rejectWildcards(board, "BoggleDictionary");
+
+    // The 8 neighbours, row by row
+    constexpr std::array<std::array<int, 2>, 8> directionSteps{
+        {{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}}};
+
+    std::vector<std::string> wordsFound{};
+    std::vector<uint8_t> visited(board.rows * board.columns, 0);
+    std::string currentWord{};
+    std::vector<SearchState<Dictionary>> stateStack{};
+
+    // Function to step from state into the cell (r, c), pushing it unless no word starts with the
+    // longer prefix
+    auto pushIfPrefix = [&](const typename Dictionary::State& state, size_t r, size_t c)
+    {
+        const char letter{board.getLetter(r, c)};
+        const typename Dictionary::State next{dictionary.step(state, letter)};
+        BOGGLE_COUNT(trieSteps, 1);
+        if (!dictionary.isPrefix(next))
+        {
+            BOGGLE_COUNT(prefixRejections, 1);
+            return;
+        }
+
+        currentWord.push_back(letter);
+        if (dictionary.isWord(next))
+        {
+            BOGGLE_COUNT(wordsEmitted, 1);
+            wordsFound.push_back(currentWord);
+        }
+        BOGGLE_COUNT(cellsExpanded, 1);
+        BOGGLE_COUNT_MAX(maxDepth, currentWord.size());
+        visited[r * board.columns + c] = 1;
+        stateStack.push_back(SearchState<Dictionary>{r, c, 0, next});
+    };
+
+    for (size_t rInit{0}; rInit < board.rows; rInit++)
+    {
+        for (size_t cInit{0}; cInit < board.columns; cInit++)
+        {
+            pushIfPrefix(dictionary.start(), rInit, cInit);
+            while (!stateStack.empty())
+            {
+                SearchState<Dictionary>& current = stateStack.back();
+
+                // If all directions from the cell are explored, backtrack
+                if (current.directionIndex >= directionSteps.size())
+                {
+                    visited[current.r * board.columns + current.c] = 0;
+                    currentWord.pop_back();
+                    stateStack.pop_back();
+                    continue;
+                }
+
+                const auto& step = directionSteps[current.directionIndex++];
+                const int nextR{static_cast<int>(current.r) + step[0]};
+                const int nextC{static_cast<int>(current.c) + step[1]};
+                if (nextR < 0 || nextR >= static_cast<int>(board.rows) || nextC < 0
+                    || nextC >= static_cast<int>(board.columns))
+                {
+                    continue;
+                }
+                const auto row{static_cast<size_t>(nextR)};
+                const auto col{static_cast<size_t>(nextC)};
+                if (visited[row * board.columns + col] == 0)
+                {
+                    // The state is copied before the stack grows
+                    const typename Dictionary::State state{current.state};
+                    pushIfPrefix(state, row, col);
+                }
+            }
+        }
+    }
+    return wordsFound;
+}
+
+// Function to look a whole string up in any BoggleDictionary, like Trie::contains
+template <BoggleDictionary Dictionary>
+inTrie containsWith(const Dictionary& dictionary, std::string_view word)
+{
+    typename Dictionary::State state{dictionary.start()};
+    for (const char letter : word)
+    {
+        state = dictionary.step(state, letter);
+        if (!dictionary.isPrefix(state))
+        {
+            return inTrie::doesntExist;
+        }
+    }
+    return dictionary.isWord(state) ? inTrie::isWord : inTrie::existsButNotWord;
+}
+
+#endif // BOGGLE_DICTIONARY_H
@@ -0,0 +1,84 @@
+#include "boggle_engines.h"
+
+#include "PackedTrie.h"
+#include "boggle_algorithm.h"
+#include "boggle_dictionary.h"
+#include "boggle_interleaved.h"
+#include "boggle_level_sync.h"
+#include "boggle_memo.h"
+#include "boggle_packed.h"
+#include "boggle_word_driven.h"
+#include "boggle_word_ids.h"
+
+#include <memory>
+
+const std::vector<SolverEngine>& getSolverEngines()
+{
+    static const std::vector<SolverEngine> engines{
+        {"recursive",
+         [](const Trie& wordsTrie) -> BoardSolver
+         {
+             return [&wordsTrie](const Board& board)
+             { return findValidWordsInBoardRecursive(wordsTrie, board); };
+         }},
+        {"iterative",
+         [](const Trie& wordsTrie) -> BoardSolver
+         {
+             return [&wordsTrie](const Board& board)
+             { return findValidWordsInBoardIterative(wordsTrie, board); };
+         }},
+        {"memoized",
+         [](const Trie& wordsTrie) -> BoardSolver
+         {
+             return [&wordsTrie](const Board& board)
+             { return findValidWordsInBoardMemoized(wordsTrie, board); };
+         }},
+        {"packed",
+         [](const Trie& wordsTrie) -> BoardSolver
+         {
+             auto packedTrie = std::make_shared<const PackedTrie>(wordsTrie,
+                                                                  TrieLayout::vanEmdeBoas);
+             return [packedTrie](const Board& board)
+             { return findValidWordsInBoardPacked(*packedTrie, board); };
+         },
+         true},
+        {"interleaved",
+         [](const Trie& wordsTrie) -> BoardSolver
+         {
+             auto packedTrie = std::make_shared<const PackedTrie>(wordsTrie,
+                                                                  TrieLayout::vanEmdeBoas);
+             return [packedTrie](const Board& board)
+             { return findValidWordsInBoardInterleaved(*packedTrie, board); };
+         }},
+        {"level-sync",
+         [](const Trie& wordsTrie) -> BoardSolver
+         {
+             auto packedTrie = std::make_shared<const PackedTrie>(wordsTrie,
+                                                                  TrieLayout::depthFirst);
+             return [packedTrie](const Board& board)
+             { return findValidWordsInBoardLevelSync(*packedTrie, board); };
+         }},
+        {"perfect-hash",
+         [](const Trie& wordsTrie) -> BoardSolver
+         {
+             auto dictionary = std::make_shared<const PerfectHashDictionary>(wordsTrie);
+             return [dictionary](const Board& board)
+             { return findValidWordsInBoardWith(*dictionary, board); };
+         }},
+        {"word-driven",
+         [](const Trie& wordsTrie) -> BoardSolver
+         {
+             auto words = std::make_shared<const std::vector<std::string>>(wordsTrie.getWords());
+             return [words](const Board& board)
+             { return findValidWordsInBoardWordDriven(*words, board); };
+         }},
+        {"word-ids",
+         [](const Trie& wordsTrie) -> BoardSolver
+         {
+             auto dictionary = std::make_shared<const WordIndex>(wordsTrie);
+             return [dictionary](const Board& board)
+             { return findValidWordIdsInBoard(*dictionary, board).toStrings(); };
+         }},
+    };
+    return engines;
+}
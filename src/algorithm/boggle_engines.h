@@ -0,0 +1,32 @@
+#ifndef BOGGLE_ENGINES_H
+#define BOGGLE_ENGINES_H
+
+#include "Board.h"
+#include "Trie.h"
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// A solver prepared for one dictionary, returning the words found in a board
+using BoardSolver = std::function<std::vector<std::string>(const Board&)>;
+
+// A solver engine of the library
+// prepare builds whatever the engine needs from the dictionary (packed trie, word list, ...) once,
+// so that the returned solver only measures the solve itself. The returned solver keeps a
+// reference to wordsTrie, which must outlive it.
+// Engines which don't support blank tiles (wildcardTile) throw std::invalid_argument for boards
+// which have one.
+struct SolverEngine
+{
+    std::string_view name;
+    std::function<BoardSolver(const Trie& wordsTrie)> prepare;
+    bool supportsBlanks{false};
+};
+
+// Function to get all solver engines which solve a single board
+// Engines may report a word once per path, so compare their results as sets
+const std::vector<SolverEngine>& getSolverEngines();
+
+#endif // BOGGLE_ENGINES_H
@@ -0,0 +1,201 @@
+#include "boggle_interleaved.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <span>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+inline void prefetch([[maybe_unused]] const void* address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#endif
+}
+
+// A cell of the path of a search
+struct Frame
+{
+    uint32_t node{0};
+    uint32_t row{0};
+    uint32_t column{0};
+    uint32_t next{0}; // next neighbour to try, 0-8 over the 3x3 block around the cell
+};
+
+// One depth-first search, from one start cell at a time
+struct Search
+{
+    std::vector<Frame> path{};
+    std::string currentWord{};
+    std::vector<std::string> wordsFound{}; // from the current start cell
+    size_t start{0};
+    uint64_t bit{0}; // of this search in the visited masks
+
+    bool finished() const
+    {
+        return path.empty();
+    }
+
+};
+
+struct InterleavedTraversal
+{
+    std::span<const PackedTrie::PackedNode> nodes;
+    const Board& board;
+    std::vector<std::pair<size_t, std::vector<std::string>>> results{}; // by start cell, unordered
+    size_t nextStart{0};
+    std::vector<uint64_t> visited{}; // by cell, bit k for search k
+
+    // Function to enter node at (r, c); nodes without children are only reported, not pushed
+    void enter(Search& search, uint32_t node, size_t r, size_t c, char letter)
+    {
+        const PackedTrie::PackedNode& packedNode = nodes[node];
+        search.currentWord.push_back(letter);
+        if (packedNode.isWord != 0)
+        {
+            search.wordsFound.push_back(search.currentWord);
+        }
+        if (packedNode.childCount == 0)
+        {
+            search.currentWord.pop_back();
+            return;
+        }
+
+        // The next step of this search scans these children; load them while the others run
+        prefetch(&nodes[packedNode.firstChild]);
+        search.path.push_back({node, static_cast<uint32_t>(r), static_cast<uint32_t>(c), 0});
+        visited[r * board.columns + c] |= search.bit;
+    }
+
+    // Function to advance search until it enters a trie node or leaves the last cell of its path
+    void step(Search& search)
+    {
+        Frame& frame = search.path.back();
+        const size_t r{frame.row};
+        const size_t c{frame.column};
+        while (frame.next < 9)
+        {
+            // Neighbour rows and columns are offset by one, so that r - 1 doesn't wrap around
+            const size_t nextR{r + frame.next / 3};
+            const size_t nextC{c + frame.next % 3};
+            frame.next++;
+            if (nextR == 0 || nextC == 0 || nextR > board.rows || nextC > board.columns)
+            {
+                continue;
+            }
+
+            if ((visited[(nextR - 1) * board.columns + nextC - 1] & search.bit) != 0)
+            {
+                continue;
+            }
+
+            const char letter{board.getLetter(nextR - 1, nextC - 1)};
+            const uint32_t child{PackedTrie::findChild(nodes, frame.node, letter)};
+            if (child != PackedTrie::noNode)
+            {
+                enter(search, child, nextR - 1, nextC - 1, letter); // frame is invalidated here
+                return;
+            }
+        }
+
+        visited[r * board.columns + c] &= ~search.bit;
+        search.path.pop_back();
+        search.currentWord.pop_back();
+    }
+
+    // Function to keep the words of a finished search
+    void collect(Search& search)
+    {
+        if (!search.wordsFound.empty())
+        {
+            results.emplace_back(search.start, std::move(search.wordsFound));
+            search.wordsFound.clear();
+        }
+    }
+
+    // Function to start search on the next start cell whose letter starts a word
+    // Returns false when all start cells have been taken
+    bool startNext(Search& search)
+    {
+        const size_t nCells{board.rows * board.columns};
+        while (nextStart < nCells)
+        {
+            search.start = nextStart++;
+            const size_t r{search.start / board.columns};
+            const size_t c{search.start % board.columns};
+            const char letter{board.getLetter(r, c)};
+            const uint32_t node{PackedTrie::findChild(nodes, PackedTrie::rootIndex, letter)};
+            if (node == PackedTrie::noNode)
+            {
+                continue;
+            }
+
+            enter(search, node, r, c, letter);
+            if (!search.finished())
+            {
+                return true;
+            }
+            collect(search); // a one-letter word without longer words
+        }
+        return false;
+    }
+
+    void run(size_t nSearches)
+    {
+        std::vector<Search> searches(std::min(nSearches, board.rows * board.columns));
+        visited.assign(board.rows * board.columns, 0);
+        size_t nActive{0};
+        for (size_t k{0}; k < searches.size(); k++)
+        {
+            Search& search = searches[k];
+            search.bit = uint64_t{1} << k;
+            nActive += startNext(search) ? 1u : 0u;
+        }
+
+        while (nActive > 0)
+        {
+            for (Search& search : searches)
+            {
+                if (search.finished())
+                {
+                    continue;
+                }
+
+                step(search);
+                if (search.finished())
+                {
+                    collect(search);
+                    nActive -= startNext(search) ? 0u : 1u;
+                }
+            }
+        }
+    }
+};
+} // namespace
+
+std::vector<std::string> findValidWordsInBoardInterleaved(const PackedTrie& wordsTrie,
+                                                          const Board& board, size_t nSearches)
+{
+    rejectWildcards(board, "interleaved");
+
+    if (nSearches == 0 || nSearches > maxInterleavedSearches)
+    {
+        throw std::invalid_argument("Interleaved solver supports 1 to 64 searches");
+    }
+
+    InterleavedTraversal traversal{wordsTrie.nodes(), board};
+    traversal.run(nSearches);
+
+    // Start cells in board order, like the depth-first solvers
+    std::sort(traversal.results.begin(), traversal.results.end(),
+              [](const auto& left, const auto& right) { return left.first < right.first; });
+    std::vector<std::string> wordsFound{};
+    for (auto& [start, words] : traversal.results)
+    {
+        std::move(words.begin(), words.end(), std::back_inserter(wordsFound));
+    }
+    return wordsFound;
+}
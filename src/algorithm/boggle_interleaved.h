@@ -0,0 +1,29 @@
+#ifndef BOGGLE_INTERLEAVED_H
+#define BOGGLE_INTERLEAVED_H
+
+#include "Board.h"
+#include "PackedTrie.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Number of interleaved searches used by default, and at most
+constexpr size_t defaultInterleavedSearches{8};
+constexpr size_t maxInterleavedSearches{64};
+
+// Main function to find valid words in board with several depth-first searches interleaved on one
+// thread
+// Up to nSearches searches from different start cells run round-robin as explicit state machines
+// (a stack of (trie node, cell, next neighbour) frames). A search is advanced until it enters one
+// trie node, whose children are then prefetched before switching to the next search, so that the
+// cache misses of the searches overlap instead of stalling one dependent chain of loads. Cells on
+// the paths are marked in one 64-bit mask per cell, bit k for search k.
+// Same results (in the same order) as findValidWordsInBoardPacked
+// Throws std::invalid_argument unless 1 <= nSearches <= maxInterleavedSearches, or if board has a
+// blank tile (wildcardTile)
+std::vector<std::string> findValidWordsInBoardInterleaved(
+    const PackedTrie& wordsTrie, const Board& board,
+    size_t nSearches = defaultInterleavedSearches);
+
+#endif // BOGGLE_INTERLEAVED_H
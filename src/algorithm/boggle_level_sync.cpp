@@ -0,0 +1,199 @@
+#include "boggle_level_sync.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+
+namespace
+{
+// A path of the frontier: its last cell and trie node, and the path without its last cell
+struct FrontierEntry
+{
+    uint32_t node{0};
+    uint32_t cell{0};
+    uint32_t parent{0}; // index in the previous level
+    uint32_t padding{0};
+    uint64_t visited{0};
+};
+
+// Entries are expanded this far ahead of their prefetch (children) and twice as far (node)
+constexpr size_t prefetchDistance{8};
+
+inline void prefetch([[maybe_unused]] const void* address)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#endif
+}
+
+struct LevelSyncTraversal
+{
+    std::span<const PackedTrie::PackedNode> nodes;
+    const Board& board;
+    LevelSyncStats& stats;
+    std::vector<std::vector<FrontierEntry>> levels{};
+    std::vector<std::string>* wordsFound{nullptr};
+
+    static uint64_t maskBit(size_t r, size_t c)
+    {
+        return uint64_t{1} << ((r % 8) * 8 + c % 8);
+    }
+
+    // Function to check whether cell is on the path ending at entry index of level
+    bool onPath(size_t level, uint32_t index, size_t cell)
+    {
+        stats.pathWalks++;
+        for (size_t l{level + 1}; l > 0; l--)
+        {
+            const FrontierEntry& entry = levels[l - 1][index];
+            if (entry.cell == cell)
+            {
+                return true;
+            }
+            index = entry.parent;
+        }
+        return false;
+    }
+
+    // Function to append the words spelled by the paths of the last level
+    void reportWords()
+    {
+        const size_t level{levels.size() - 1};
+        for (const FrontierEntry& entry : levels.back())
+        {
+            if (nodes[entry.node].isWord == 0)
+            {
+                continue;
+            }
+            std::string word(level + 1, '\0');
+            uint32_t index{entry.parent};
+            word[level] = nodes[entry.node].letter;
+            for (size_t l{level}; l > 0; l--)
+            {
+                const FrontierEntry& prefix = levels[l - 1][index];
+                word[l - 1] = nodes[prefix.node].letter;
+                index = prefix.parent;
+            }
+            wordsFound->push_back(std::move(word));
+        }
+    }
+
+    // Function to sort the last level by trie node (then cell and parent, for a fixed order)
+    void sortLastLevel()
+    {
+        auto& level = levels.back();
+        std::sort(level.begin(), level.end(),
+                  [](const FrontierEntry& left, const FrontierEntry& right)
+                  {
+                      if (left.node != right.node)
+                      {
+                          return left.node < right.node;
+                      }
+                      return left.cell != right.cell ? left.cell < right.cell
+                                                     : left.parent < right.parent;
+                  });
+        stats.levels++;
+        stats.paths += level.size();
+        stats.largestLevel = std::max(stats.largestLevel, level.size());
+    }
+
+    // Function to expand every path of the last level by one cell into a new level
+    void expandLastLevel()
+    {
+        const size_t level{levels.size() - 1};
+        const bool exactMask{(board.rows <= 8 && board.columns <= 8) || level + 2 <= 8};
+        std::vector<FrontierEntry> next;
+        const std::vector<FrontierEntry>& frontier = levels.back();
+        next.reserve(frontier.size());
+
+        for (size_t i{0}; i < frontier.size(); i++)
+        {
+            if (i + 2 * prefetchDistance < frontier.size())
+            {
+                prefetch(&nodes[frontier[i + 2 * prefetchDistance].node]);
+            }
+            if (i + prefetchDistance < frontier.size())
+            {
+                prefetch(&nodes[nodes[frontier[i + prefetchDistance].node].firstChild]);
+            }
+
+            const FrontierEntry& entry = frontier[i];
+            const size_t r{entry.cell / board.columns};
+            const size_t c{entry.cell % board.columns};
+            const size_t rBegin{r > 0 ? r - 1 : 0};
+            const size_t cBegin{c > 0 ? c - 1 : 0};
+            const size_t rEnd{r + 1 < board.rows ? r + 1 : r};
+            const size_t cEnd{c + 1 < board.columns ? c + 1 : c};
+            for (size_t nextR{rBegin}; nextR <= rEnd; nextR++)
+            {
+                for (size_t nextC{cBegin}; nextC <= cEnd; nextC++)
+                {
+                    const size_t cell{nextR * board.columns + nextC};
+                    const uint64_t bit{maskBit(nextR, nextC)};
+                    if ((entry.visited & bit) != 0
+                        && (exactMask || onPath(level, static_cast<uint32_t>(i), cell)))
+                    {
+                        continue;
+                    }
+
+                    const uint32_t child{
+                        PackedTrie::findChild(nodes, entry.node, board.getLetter(nextR, nextC))};
+                    if (child != PackedTrie::noNode)
+                    {
+                        next.push_back({child, static_cast<uint32_t>(cell),
+                                        static_cast<uint32_t>(i), 0, entry.visited | bit});
+                    }
+                }
+            }
+        }
+        levels.push_back(std::move(next));
+    }
+
+    void run()
+    {
+        // Level 0: the paths of one cell
+        levels.emplace_back();
+        for (size_t r{0}; r < board.rows; r++)
+        {
+            for (size_t c{0}; c < board.columns; c++)
+            {
+                const uint32_t start{PackedTrie::findChild(nodes, PackedTrie::rootIndex,
+                                                           board.getLetter(r, c))};
+                if (start != PackedTrie::noNode)
+                {
+                    const size_t cell{r * board.columns + c};
+                    levels.back().push_back(
+                        {start, static_cast<uint32_t>(cell), 0, 0, maskBit(r, c)});
+                }
+            }
+        }
+
+        while (!levels.back().empty())
+        {
+            sortLastLevel();
+            reportWords();
+            expandLastLevel();
+        }
+        stats.levels++;
+    }
+};
+} // namespace
+
+std::vector<std::string> findValidWordsInBoardLevelSync(const PackedTrie& wordsTrie,
+                                                        const Board& board)
+{
+    LevelSyncStats stats;
+    return findValidWordsInBoardLevelSync(wordsTrie, board, stats);
+}
+
+std::vector<std::string> findValidWordsInBoardLevelSync(const PackedTrie& wordsTrie,
+                                                        const Board& board, LevelSyncStats& stats)
+{
+    rejectWildcards(board, "level-sync");
+
+    std::vector<std::string> wordsFound{};
+    LevelSyncTraversal traversal{wordsTrie.nodes(), board, stats};
+    traversal.wordsFound = &wordsFound;
+    traversal.run();
+    return wordsFound;
+}
@@ -0,0 +1,37 @@
+#ifndef BOGGLE_LEVEL_SYNC_H
+#define BOGGLE_LEVEL_SYNC_H
+
+#include "Board.h"
+#include "PackedTrie.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Sizes of the frontiers of a level-synchronous solve
+struct LevelSyncStats
+{
+    size_t levels{0};        // longest path + 1 (the last level is empty)
+    size_t paths{0};         // paths expanded over all levels
+    size_t largestLevel{0};  // paths of the largest level
+    size_t pathWalks{0};     // visited-mask hits confirmed by walking the path
+};
+
+// Main function to find valid words in board breadth-first, one path length at a time
+// Every level is a compact array of the live paths of k letters (last cell, trie node, parent in
+// the previous level, visited mask), expanded into the paths of k + 1 letters in one batch. Each
+// new level is sorted by trie node, so that paths in the same part of the trie are expanded
+// together, and the nodes of the paths ahead are prefetched while a path is expanded.
+// The visited mask has bit (r % 8) * 8 + c % 8 for every cell of the path, so it is exact as long
+// as a path spans fewer than 9 rows and columns; past that, a hit is confirmed by walking the path.
+// Words are reported once per path, like findValidWordsInBoardIterative, but ordered by length
+// (level) and then by trie node instead of in depth-first order.
+// Throws std::invalid_argument if board has a blank tile (wildcardTile)
+std::vector<std::string> findValidWordsInBoardLevelSync(const PackedTrie& wordsTrie,
+                                                        const Board& board);
+
+// Overload which also reports the sizes of the frontiers
+std::vector<std::string> findValidWordsInBoardLevelSync(const PackedTrie& wordsTrie,
+                                                        const Board& board, LevelSyncStats& stats);
+
+#endif // BOGGLE_LEVEL_SYNC_H
@@ -0,0 +1,243 @@
+#include "boggle_lockstep.h"
+
+#include "boggle_algorithm.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace
+{
+// Neighbours of every cell, in the direction order of findValidWordsInBoardIterative
+std::vector<std::vector<uint8_t>> computeNeighbors(size_t rows, size_t columns)
+{
+    constexpr std::array<std::array<int, 2>, 8> directionSteps
+        = {{{-1, -1}, {-1, 0}, {-1, 1}, {0, -1}, {0, 1}, {1, -1}, {1, 0}, {1, 1}}};
+
+    std::vector<std::vector<uint8_t>> neighbors(rows * columns);
+    for (size_t cell{0}; cell < rows * columns; cell++)
+    {
+        const auto r{static_cast<int>(cell / columns)};
+        const auto c{static_cast<int>(cell % columns)};
+
+        for (const auto& step : directionSteps)
+        {
+            const int newR{r + step[0]};
+            const int newC{c + step[1]};
+            if (newR >= 0 && newR < static_cast<int>(rows) && newC >= 0
+                && newC < static_cast<int>(columns))
+            {
+                neighbors[cell].push_back(static_cast<uint8_t>(static_cast<size_t>(newR) * columns
+                                                               + static_cast<size_t>(newC)));
+            }
+        }
+    }
+    return neighbors;
+}
+
+// Advances the state of every lane by its letter column; returns whether any lane is still alive
+template <size_t Lanes>
+bool stepLanes(const uint32_t* transitions, uint32_t nColumns, const uint32_t* current,
+               const uint32_t* columns, uint32_t* next)
+{
+#if defined(__AVX2__)
+    static_assert(Lanes % 8 == 0, "AVX2 path processes lanes in groups of 8");
+
+    const __m256i stride = _mm256_set1_epi32(static_cast<int>(nColumns));
+    __m256i anyAlive = _mm256_setzero_si256();
+    for (size_t lane{0}; lane < Lanes; lane += 8)
+    {
+        const __m256i state
+            = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(current + lane));
+        const __m256i column
+            = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(columns + lane));
+        const __m256i index = _mm256_add_epi32(_mm256_mullo_epi32(state, stride), column);
+        const __m256i nextState
+            = _mm256_i32gather_epi32(reinterpret_cast<const int*>(transitions), index, 4);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(next + lane), nextState);
+        anyAlive = _mm256_or_si256(anyAlive, nextState);
+    }
+    return _mm256_testz_si256(anyAlive, anyAlive) == 0;
+#else
+    uint32_t anyAlive{0};
+    for (size_t lane{0}; lane < Lanes; lane++)
+    {
+        next[lane] = transitions[current[lane] * nColumns + columns[lane]];
+        anyAlive |= next[lane];
+    }
+    return anyAlive != 0;
+#endif
+}
+
+// Solves boards[first, first + count) (count <= Lanes) in lockstep
+template <size_t Lanes>
+void solveGroup(const TrieTable& wordsTable, const std::vector<Board>& boards, size_t first,
+                size_t count, const std::vector<std::vector<uint8_t>>& neighbors,
+                std::vector<std::vector<std::string>>& wordsFound)
+{
+    const size_t nCells{neighbors.size()};
+    const size_t columns{boards[first].columns};
+    const uint32_t* transitions{wordsTable.transitions()};
+    const uint8_t* wordFlags{wordsTable.wordFlags()};
+    const auto nColumns{static_cast<uint32_t>(wordsTable.columnCount())};
+
+    // Letter column of every cell for every lane; unused lanes read "other" and stay dead
+    std::vector<uint32_t> cellColumns(nCells * Lanes, nColumns - 1);
+    for (size_t lane{0}; lane < count; lane++)
+    {
+        for (size_t cell{0}; cell < nCells; cell++)
+        {
+            cellColumns[cell * Lanes + lane] = wordsTable.letterColumn(
+                boards[first + lane].getLetter(cell / columns, cell % columns));
+        }
+    }
+
+    // Per depth of the current path: lane states, cell and next neighbour to explore
+    std::vector<std::array<uint32_t, Lanes>> states(nCells);
+    std::vector<uint8_t> path(nCells);
+    std::vector<uint8_t> nextNeighbor(nCells);
+    std::array<uint32_t, Lanes> rootStates{};
+    rootStates.fill(TrieTable::rootState);
+
+    auto emitWords = [&](size_t depth)
+    {
+        for (size_t lane{0}; lane < count; lane++)
+        {
+            if (wordFlags[states[depth][lane]] != 0)
+            {
+                const Board& board = boards[first + lane];
+                std::string word(depth + 1, '\0');
+                for (size_t i{0}; i <= depth; i++)
+                {
+                    word[i] = board.getLetter(path[i] / columns, path[i] % columns);
+                }
+                wordsFound[first + lane].push_back(std::move(word));
+            }
+        }
+    };
+
+    for (size_t start{0}; start < nCells; start++)
+    {
+        if (!stepLanes<Lanes>(transitions, nColumns, rootStates.data(), &cellColumns[start * Lanes],
+                              states[0].data()))
+        {
+            continue;
+        }
+
+        size_t depth{0};
+        path[0] = static_cast<uint8_t>(start);
+        nextNeighbor[0] = 0;
+        uint64_t visited{uint64_t{1} << start};
+        emitWords(0);
+
+        while (true)
+        {
+            const size_t cell{path[depth]};
+
+            // If all neighbours are explored, backtrack
+            if (nextNeighbor[depth] == neighbors[cell].size())
+            {
+                visited &= ~(uint64_t{1} << cell);
+                if (depth == 0)
+                {
+                    break;
+                }
+                depth--;
+                continue;
+            }
+
+            const size_t neighbor{neighbors[cell][nextNeighbor[depth]++]};
+            if ((visited & (uint64_t{1} << neighbor)) != 0)
+            {
+                continue;
+            }
+
+            if (!stepLanes<Lanes>(transitions, nColumns, states[depth].data(),
+                                  &cellColumns[neighbor * Lanes], states[depth + 1].data()))
+            {
+                continue;
+            }
+
+            depth++;
+            path[depth] = static_cast<uint8_t>(neighbor);
+            nextNeighbor[depth] = 0;
+            visited |= uint64_t{1} << neighbor;
+            emitWords(depth);
+        }
+    }
+}
+
+template <size_t Lanes>
+void solveAllGroups(const TrieTable& wordsTable, const std::vector<Board>& boards,
+                    const std::vector<std::vector<uint8_t>>& neighbors,
+                    std::vector<std::vector<std::string>>& wordsFound)
+{
+    for (size_t first{0}; first < boards.size(); first += Lanes)
+    {
+        const size_t count{std::min(Lanes, boards.size() - first)};
+        solveGroup<Lanes>(wordsTable, boards, first, count, neighbors, wordsFound);
+    }
+}
+} // namespace
+
+std::vector<std::vector<std::string>> findValidWordsInBoardsLockstep(const TrieTable& wordsTable,
+                                                                     const std::vector<Board>& boards,
+                                                                     size_t lanes)
+{
+    std::vector<std::vector<std::string>> wordsFound(boards.size());
+    if (boards.empty())
+    {
+        return wordsFound;
+    }
+
+    const size_t rows{boards.front().rows};
+    const size_t columns{boards.front().columns};
+    for (const auto& board : boards)
+    {
+        if (board.rows != rows || board.columns != columns)
+        {
+            throw std::invalid_argument("Lockstep solver requires boards of the same dimensions");
+        }
+        rejectWildcards(board, "lockstep");
+    }
+    if (rows * columns > LOCKSTEP_MAX_CELLS)
+    {
+        throw std::invalid_argument("Lockstep solver supports boards of at most 64 cells");
+    }
+
+    const auto neighbors = computeNeighbors(rows, columns);
+    switch (lanes)
+    {
+    case 8:
+        solveAllGroups<8>(wordsTable, boards, neighbors, wordsFound);
+        break;
+    case 16:
+        solveAllGroups<16>(wordsTable, boards, neighbors, wordsFound);
+        break;
+    case 32:
+        solveAllGroups<32>(wordsTable, boards, neighbors, wordsFound);
+        break;
+    default:
+        throw std::invalid_argument("Lockstep solver supports 8, 16 or 32 lanes");
+    }
+
+    return wordsFound;
+}
+
+std::vector<std::vector<std::string>> findValidWordsInBoardsIterative(const Trie& wordsTrie,
+                                                                      const std::vector<Board>& boards)
+{
+    std::vector<std::vector<std::string>> wordsFound;
+    wordsFound.reserve(boards.size());
+    for (const auto& board : boards)
+    {
+        wordsFound.push_back(findValidWordsInBoardIterative(wordsTrie, board));
+    }
+    return wordsFound;
+}
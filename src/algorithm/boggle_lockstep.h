@@ -0,0 +1,31 @@
+#ifndef BOGGLE_LOCKSTEP_H
+#define BOGGLE_LOCKSTEP_H
+
+#include "Board.h"
+#include "Trie.h"
+#include "TrieTable.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Largest number of cells supported by the lockstep solver (visited cells are a 64-bit mask)
+constexpr size_t LOCKSTEP_MAX_CELLS{64};
+
+// Main function to find valid words in many boards of the same dimensions at once
+// Boards are solved in groups of `lanes` (8, 16 or 32). Since the neighbour structure only depends
+// on the dimensions, a single depth-first search over cell paths serves the whole group: each path
+// step advances one TrieTable state per board (vectorized with AVX2 when available), and a branch is
+// abandoned only when the states of all boards in the group are dead.
+// Returns, for each board, the same words as findValidWordsInBoardIterative, in the same order.
+// Throws std::invalid_argument if the boards differ in size, have more than LOCKSTEP_MAX_CELLS
+// cells or a blank tile (wildcardTile), or if lanes is not supported.
+std::vector<std::vector<std::string>> findValidWordsInBoardsLockstep(const TrieTable& wordsTable,
+                                                                     const std::vector<Board>& boards,
+                                                                     size_t lanes = 8);
+
+// Scalar batch counterpart: solves each board with findValidWordsInBoardIterative
+std::vector<std::vector<std::string>> findValidWordsInBoardsIterative(const Trie& wordsTrie,
+                                                                      const std::vector<Board>& boards);
+
+#endif // BOGGLE_LOCKSTEP_H
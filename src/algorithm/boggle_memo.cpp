@@ -0,0 +1,153 @@
+#include "boggle_memo.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+namespace
+{
+constexpr size_t notBlocked{std::numeric_limits<size_t>::max()};
+
+// Result of exploring the subtree of a (cell, trie node) pair
+struct SubtreeResult
+{
+    bool foundWord{false};
+    size_t shallowestBlock{notBlocked}; // smallest path depth of a visited cell that blocked a step
+};
+
+struct MemoizedTraversal
+{
+    const Board& board;
+    const size_t nNodes;
+    const bool useMemo;
+    std::vector<uint64_t> deadEnds{};  // bitset indexed by cell * nNodes + node id
+    std::vector<size_t> visitDepth{};  // per cell, 1 + depth on the current path (0: not visited)
+    std::string currentWord{};
+    std::vector<std::string>& wordsFound;
+    DeadEndStats stats{};
+
+    bool isDeadEnd(size_t cell, const Node& node) const
+    {
+        const size_t key{cell * nNodes + node.getId()};
+        return (deadEnds[key / 64] >> (key % 64) & 1) != 0;
+    }
+
+    void recordDeadEnd(size_t cell, const Node& node)
+    {
+        const size_t key{cell * nNodes + node.getId()};
+        deadEnds[key / 64] |= uint64_t{1} << (key % 64);
+        stats.deadEndsRecorded++;
+    }
+
+    // Explores the paths continuing from cell, whose letter (at path depth) leads to node
+    SubtreeResult visit(const Node& node, size_t cell, size_t depth)
+    {
+        stats.expansions++;
+
+        SubtreeResult result;
+        currentWord.push_back(board.getLetter(cell / board.columns, cell % board.columns));
+        if (node.isValidWord())
+        {
+            wordsFound.push_back(currentWord);
+            result.foundWord = true;
+        }
+
+        visitDepth[cell] = depth + 1;
+
+        const auto r{static_cast<int>(cell / board.columns)};
+        const auto c{static_cast<int>(cell % board.columns)};
+        for (int nextR{r - 1}; nextR <= r + 1; nextR++)
+        {
+            for (int nextC{c - 1}; nextC <= c + 1; nextC++)
+            {
+                if ((nextR < 0) || (nextR >= static_cast<int>(board.rows)) || (nextC < 0)
+                    || (nextC >= static_cast<int>(board.columns)))
+                {
+                    continue;
+                }
+
+                const size_t nextCell{static_cast<size_t>(nextR) * board.columns
+                                      + static_cast<size_t>(nextC)};
+                const Node* child = node.findChild(
+                    board.getLetter(static_cast<size_t>(nextR), static_cast<size_t>(nextC)));
+                if (!child)
+                {
+                    continue;
+                }
+
+                // A step that the trie allows but a visited cell blocks
+                if (visitDepth[nextCell] != 0)
+                {
+                    result.shallowestBlock
+                        = std::min(result.shallowestBlock, visitDepth[nextCell] - 1);
+                    continue;
+                }
+
+                if (useMemo && isDeadEnd(nextCell, *child))
+                {
+                    stats.memoHits++;
+                    continue;
+                }
+
+                const auto childResult = visit(*child, nextCell, depth + 1);
+                result.foundWord = result.foundWord || childResult.foundWord;
+                result.shallowestBlock
+                    = std::min(result.shallowestBlock, childResult.shallowestBlock);
+            }
+        }
+
+        visitDepth[cell] = 0;
+        currentWord.pop_back();
+
+        // Only blocked by cells of this subtree's own path: the outcome doesn't depend on the
+        // cells visited before, so an empty subtree is empty under any visited set
+        if (useMemo && !result.foundWord && result.shallowestBlock >= depth)
+        {
+            recordDeadEnd(cell, node);
+        }
+
+        return result;
+    }
+};
+} // namespace
+
+std::vector<std::string> findValidWordsInBoardMemoized(const Trie& wordsTrie, const Board& board,
+                                                       DeadEndStats* stats, bool useMemo)
+{
+    rejectWildcards(board, "memoized");
+
+    std::vector<std::string> wordsFound{};
+
+    const size_t nCells{board.rows * board.columns};
+    const size_t nNodes{wordsTrie.getNodeCount()};
+    MemoizedTraversal traversal{board, nNodes, useMemo, {}, {}, {}, wordsFound, {}};
+    if (useMemo)
+    {
+        traversal.deadEnds.assign((nCells * nNodes + 63) / 64, 0);
+    }
+    traversal.visitDepth.assign(nCells, 0);
+
+    for (size_t cell{0}; cell < nCells; cell++)
+    {
+        const Node* start = wordsTrie.getRoot().findChild(
+            board.getLetter(cell / board.columns, cell % board.columns));
+        if (!start)
+        {
+            continue;
+        }
+
+        if (useMemo && traversal.isDeadEnd(cell, *start))
+        {
+            traversal.stats.memoHits++;
+            continue;
+        }
+
+        traversal.visit(*start, cell, 0);
+    }
+
+    if (stats)
+    {
+        *stats = traversal.stats;
+    }
+    return wordsFound;
+}
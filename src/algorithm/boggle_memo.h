@@ -0,0 +1,33 @@
+#ifndef BOGGLE_MEMO_H
+#define BOGGLE_MEMO_H
+
+#include "Board.h"
+#include "Trie.h"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Counters of a solve with dead-end memoization
+struct DeadEndStats
+{
+    size_t expansions{0};       // (cell, trie node) pairs expanded
+    size_t deadEndsRecorded{0}; // pairs proven to never lead to a word
+    size_t memoHits{0};         // visits of proven dead ends which were skipped
+};
+
+// Main function to find valid words in board, skipping proven dead ends
+// Like findValidWordsInBoardRecursive, but walks the trie node by node and keeps a per-solve table,
+// keyed by (cell index, trie node id), of the pairs whose subtree can't produce a word.
+// Whether a subtree has words only shrinks as more cells are visited, so a pair is only recorded
+// as dead when its exploration found no word and was never cut short by a cell visited *before* it
+// on the path; it's then dead under any set of visited cells and is skipped on later visits.
+// Returns the same words, in the same order, as findValidWordsInBoardRecursive.
+// The table takes one bit per (cell, trie node) pair.
+// With useMemo = false no pair is skipped, to count the expansions of the plain traversal.
+// Throws std::invalid_argument if board has a blank tile (wildcardTile)
+std::vector<std::string> findValidWordsInBoardMemoized(const Trie& wordsTrie, const Board& board,
+                                                       DeadEndStats* stats = nullptr,
+                                                       bool useMemo = true);
+
+#endif // BOGGLE_MEMO_H
@@ -0,0 +1,89 @@
+#include "boggle_multi.h"
+
+#include <bit>
+
+namespace
+{
+struct MultiTraversal
+{
+    const MultiTrie& wordsTrie;
+    const Board& board;
+    uint64_t listMask;
+    std::vector<std::vector<std::string>>& wordsFound;
+    std::vector<uint8_t> visited{};
+    std::string currentWord{};
+
+    // Function to get the child of node for letter, if it leads to a word of a requested list
+    uint32_t findChild(uint32_t node, char letter) const
+    {
+        const uint32_t child{wordsTrie.trie().findChild(node, letter)};
+        if (child == PackedTrie::noNode || (wordsTrie.subtreeMask(child) & listMask) == 0)
+        {
+            return PackedTrie::noNode;
+        }
+        return child;
+    }
+
+    void visit(uint32_t node, size_t r, size_t c)
+    {
+        const size_t cell{r * board.columns + c};
+        currentWord.push_back(board.getLetter(r, c));
+
+        // Report the word to every requested list it belongs to
+        for (uint64_t lists{wordsTrie.wordMask(node) & listMask}; lists != 0; lists &= lists - 1)
+        {
+            wordsFound[static_cast<size_t>(std::countr_zero(lists))].push_back(currentWord);
+        }
+        visited[cell] = 1;
+
+        const size_t rBegin{r > 0 ? r - 1 : 0};
+        const size_t cBegin{c > 0 ? c - 1 : 0};
+        const size_t rEnd{r + 1 < board.rows ? r + 1 : r};
+        const size_t cEnd{c + 1 < board.columns ? c + 1 : c};
+        for (size_t nextR{rBegin}; nextR <= rEnd; nextR++)
+        {
+            for (size_t nextC{cBegin}; nextC <= cEnd; nextC++)
+            {
+                if (visited[nextR * board.columns + nextC] != 0)
+                {
+                    continue;
+                }
+
+                const uint32_t child{findChild(node, board.getLetter(nextR, nextC))};
+                if (child != PackedTrie::noNode)
+                {
+                    visit(child, nextR, nextC);
+                }
+            }
+        }
+
+        visited[cell] = 0;
+        currentWord.pop_back();
+    }
+};
+} // namespace
+
+std::vector<std::vector<std::string>> findValidWordsInBoardMulti(const MultiTrie& wordsTrie,
+                                                                 const Board& board,
+                                                                 uint64_t listMask)
+{
+    rejectWildcards(board, "multi-list");
+
+    std::vector<std::vector<std::string>> wordsFound(wordsTrie.listCount());
+
+    MultiTraversal traversal{wordsTrie, board, listMask, wordsFound};
+    traversal.visited.assign(board.rows * board.columns, 0);
+    for (size_t r{0}; r < board.rows; r++)
+    {
+        for (size_t c{0}; c < board.columns; c++)
+        {
+            const uint32_t start{traversal.findChild(PackedTrie::rootIndex, board.getLetter(r, c))};
+            if (start != PackedTrie::noNode)
+            {
+                traversal.visit(start, r, c);
+            }
+        }
+    }
+
+    return wordsFound;
+}
@@ -0,0 +1,22 @@
+#ifndef BOGGLE_MULTI_H
+#define BOGGLE_MULTI_H
+
+#include "Board.h"
+#include "MultiTrie.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Main function to find the valid words of several word lists in board with a single traversal
+// Returns the words found for every list of wordsTrie (indexed like its lists); lists not in
+// listMask are skipped and stay empty. Each list gets the same words, in the same order, as
+// findValidWordsInBoardRecursive with a Trie of that list alone. Subtrees without a word of a
+// requested list are not visited.
+// Throws std::invalid_argument if board has a blank tile (wildcardTile)
+std::vector<std::vector<std::string>> findValidWordsInBoardMulti(const MultiTrie& wordsTrie,
+                                                                 const Board& board,
+                                                                 uint64_t listMask
+                                                                 = MultiTrie::allLists);
+
+#endif // BOGGLE_MULTI_H
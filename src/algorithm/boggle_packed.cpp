@@ -0,0 +1,255 @@
+#include "boggle_packed.h"
+
+#include <cctype>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <string_view>
+
+namespace
+{
+// No-op counters, for solves without statistics
+struct NoCounters
+{
+    void childScan(uint32_t, uint32_t)
+    {
+    }
+    void visit(uint32_t)
+    {
+    }
+};
+
+// Counters of node accesses and cache line switches
+struct LineCounters
+{
+    PackedSolveStats& stats;
+    size_t lastLine{SIZE_MAX};
+
+    void access(uint32_t node)
+    {
+        const size_t line{node * sizeof(PackedTrie::PackedNode) / 64};
+        stats.nodeAccesses++;
+        if (line != lastLine)
+        {
+            stats.lineSwitches++;
+            lastLine = line;
+        }
+    }
+
+    // Siblings [first, found] are read while searching for a child
+    void childScan(uint32_t first, uint32_t last)
+    {
+        for (uint32_t node{first}; node <= last; node++)
+        {
+            access(node);
+        }
+    }
+
+    void visit(uint32_t)
+    {
+    }
+};
+
+// Hit counters by packed node
+struct HitCounters
+{
+    std::vector<uint64_t>& hits;
+
+    void childScan(uint32_t, uint32_t)
+    {
+    }
+
+    void visit(uint32_t node)
+    {
+        hits[node]++;
+    }
+};
+
+// Scratch state (visit flags, current word) is allocated from resource, words found are appended
+// to a Words container (std::vector<std::string> or std::pmr::vector<std::pmr::string>)
+// BoardType is Board or ZOrderBoard; the visit flags are row-major for both
+template <typename Counters, typename Words = std::vector<std::string>,
+          typename BoardType = Board>
+struct PackedTraversal
+{
+    std::span<const PackedTrie::PackedNode> nodes;
+    const BoardType& board;
+    Counters& counters;
+    std::pmr::memory_resource* resource{std::pmr::get_default_resource()};
+    std::pmr::vector<uint8_t> visited{resource};
+    std::pmr::string currentWord{resource};
+    Words* wordsFound{nullptr};
+    bool markBlanks{false}; // write the letters taken by wildcard cells in lower case
+
+    uint32_t findChild(uint32_t node, char letter)
+    {
+        const uint32_t child{PackedTrie::findChild(nodes, node, letter)};
+        const auto& packedNode = nodes[node];
+        if (packedNode.childCount > 0)
+        {
+            counters.childScan(packedNode.firstChild, child == PackedTrie::noNode
+                                                          ? packedNode.firstChild
+                                                                + packedNode.childCount - 1u
+                                                          : child);
+        }
+        return child;
+    }
+
+    // Visits the cell (r, c) with the letter of the cell, or with every child of node at a
+    // wildcard cell, in one pass over the children
+    void step(uint32_t node, size_t r, size_t c)
+    {
+        const char letter{board.getLetter(r, c)};
+        if (letter != wildcardTile)
+        {
+            const uint32_t child{findChild(node, letter)};
+            if (child != PackedTrie::noNode)
+            {
+                visit(child, r, c);
+            }
+            return;
+        }
+
+        const auto& packedNode = nodes[node];
+        if (packedNode.childCount > 0)
+        {
+            counters.childScan(packedNode.firstChild,
+                               packedNode.firstChild + packedNode.childCount - 1u);
+        }
+        for (uint32_t child{packedNode.firstChild};
+             child < packedNode.firstChild + packedNode.childCount; child++)
+        {
+            visit(child, r, c);
+        }
+    }
+
+    void visit(uint32_t node, size_t r, size_t c)
+    {
+        counters.visit(node);
+        const size_t cell{r * board.columns + c};
+        const char letter{nodes[node].letter};
+        const bool blank{markBlanks && board.getLetter(r, c) == wildcardTile};
+        currentWord.push_back(
+            blank ? static_cast<char>(std::tolower(static_cast<unsigned char>(letter))) : letter);
+        if (wordsFound && nodes[node].isWord != 0)
+        {
+            wordsFound->emplace_back(std::string_view{currentWord});
+        }
+        visited[cell] = 1;
+
+        const size_t rBegin{r > 0 ? r - 1 : 0};
+        const size_t cBegin{c > 0 ? c - 1 : 0};
+        const size_t rEnd{r + 1 < board.rows ? r + 1 : r};
+        const size_t cEnd{c + 1 < board.columns ? c + 1 : c};
+        for (size_t nextR{rBegin}; nextR <= rEnd; nextR++)
+        {
+            for (size_t nextC{cBegin}; nextC <= cEnd; nextC++)
+            {
+                if (visited[nextR * board.columns + nextC] == 0)
+                {
+                    step(node, nextR, nextC);
+                }
+            }
+        }
+
+        visited[cell] = 0;
+        currentWord.pop_back();
+    }
+
+    void run()
+    {
+        visited.assign(board.rows * board.columns, 0);
+        for (size_t r{0}; r < board.rows; r++)
+        {
+            for (size_t c{0}; c < board.columns; c++)
+            {
+                step(PackedTrie::rootIndex, r, c);
+            }
+        }
+    }
+};
+} // namespace
+
+std::vector<std::string> findValidWordsInBoardPacked(const PackedTrie& wordsTrie,
+                                                     const Board& board)
+{
+    return findValidWordsInBoardPacked(std::span<const PackedTrie::PackedNode>(wordsTrie.nodes()),
+                                       board);
+}
+
+std::vector<std::string> findValidWordsInBoardPacked(std::span<const PackedTrie::PackedNode> nodes,
+                                                     const Board& board)
+{
+    std::vector<std::string> wordsFound{};
+    NoCounters counters;
+    PackedTraversal<NoCounters> traversal{nodes, board, counters};
+    traversal.wordsFound = &wordsFound;
+    traversal.run();
+    return wordsFound;
+}
+
+std::vector<std::string> findValidWordsInBoardPacked(const PackedTrie& wordsTrie,
+                                                     const Board& board, PackedSolveStats& stats)
+{
+    std::vector<std::string> wordsFound{};
+    LineCounters counters{stats};
+    PackedTraversal<LineCounters> traversal{wordsTrie.nodes(), board, counters};
+    traversal.wordsFound = &wordsFound;
+    traversal.run();
+    return wordsFound;
+}
+
+std::vector<std::string> findValidWordsInBoardPacked(const PackedTrie& wordsTrie,
+                                                     const ZOrderBoard& board)
+{
+    std::vector<std::string> wordsFound{};
+    NoCounters counters;
+    PackedTraversal<NoCounters, std::vector<std::string>, ZOrderBoard> traversal{
+        wordsTrie.nodes(), board, counters};
+    traversal.wordsFound = &wordsFound;
+    traversal.run();
+    return wordsFound;
+}
+
+std::vector<std::string> findBlankMarkedWordsPacked(const PackedTrie& wordsTrie,
+                                                    const Board& board)
+{
+    std::vector<std::string> wordsFound{};
+    NoCounters counters;
+    PackedTraversal<NoCounters> traversal{wordsTrie.nodes(), board, counters};
+    traversal.wordsFound = &wordsFound;
+    traversal.markBlanks = true;
+    traversal.run();
+    return wordsFound;
+}
+
+std::pmr::vector<std::pmr::string> findValidWordsInBoardPacked(const PackedTrie& wordsTrie,
+                                                               const Board& board,
+                                                               std::pmr::memory_resource* resource)
+{
+    std::pmr::vector<std::pmr::string> wordsFound{resource};
+    NoCounters counters;
+    PackedTraversal<NoCounters, std::pmr::vector<std::pmr::string>> traversal{
+        wordsTrie.nodes(), board, counters, resource};
+    traversal.wordsFound = &wordsFound;
+    traversal.run();
+    return wordsFound;
+}
+
+std::vector<uint64_t> profileNodeHits(const PackedTrie& wordsTrie, const std::vector<Board>& samples)
+{
+    std::vector<uint64_t> packedHits(wordsTrie.nodeCount(), 0);
+    HitCounters counters{packedHits};
+    for (const auto& board : samples)
+    {
+        PackedTraversal<HitCounters> traversal{wordsTrie.nodes(), board, counters};
+        traversal.run();
+    }
+
+    std::vector<uint64_t> hits(wordsTrie.nodeCount(), 0);
+    for (uint32_t node{0}; node < wordsTrie.nodeCount(); node++)
+    {
+        hits[wordsTrie.trieNodeId(node)] = packedHits[node];
+    }
+    return hits;
+}
@@ -0,0 +1,59 @@
+#ifndef BOGGLE_PACKED_H
+#define BOGGLE_PACKED_H
+
+#include "Board.h"
+#include "PackedTrie.h"
+#include "ZOrderBoard.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <span>
+#include <string>
+#include <vector>
+
+// Memory access counters of a solve over a PackedTrie
+struct PackedSolveStats
+{
+    size_t nodeAccesses{0}; // packed nodes read (including siblings scanned)
+    size_t lineSwitches{0}; // accesses to a different 64-byte line than the previous access
+};
+
+// Main function to find valid words in board using a PackedTrie
+// Same traversal and results (in the same order) as findValidWordsInBoardRecursive; a wildcard
+// cell (wildcardTile) takes the letter of every child of the trie node in turn
+std::vector<std::string> findValidWordsInBoardPacked(const PackedTrie& wordsTrie,
+                                                     const Board& board);
+
+// Overload solving with the nodes of a PackedTrie stored elsewhere, e.g. in shared memory
+std::vector<std::string> findValidWordsInBoardPacked(std::span<const PackedTrie::PackedNode> nodes,
+                                                     const Board& board);
+
+// Overload which also counts the node accesses and the cache lines they switch between, as a
+// model of the cache behaviour of the layout
+std::vector<std::string> findValidWordsInBoardPacked(const PackedTrie& wordsTrie,
+                                                     const Board& board, PackedSolveStats& stats);
+
+// Overload for a board in Z-order; same results, in the same order, as for the row-major board
+std::vector<std::string> findValidWordsInBoardPacked(const PackedTrie& wordsTrie,
+                                                     const ZOrderBoard& board);
+
+// Function like findValidWordsInBoardPacked, but writing the letters assigned to wildcard cells in
+// lower case (e.g. "CaT" for "CAT" with a blank as the A), so that a word spelled with and without
+// blanks is reported for each assignment
+std::vector<std::string> findBlankMarkedWordsPacked(const PackedTrie& wordsTrie,
+                                                    const Board& board);
+
+// Overload allocating the scratch state and the words found from resource
+// Per-request work can then run on a std::pmr::monotonic_buffer_resource and be released in one
+// go; the result must not outlive resource
+std::pmr::vector<std::pmr::string> findValidWordsInBoardPacked(const PackedTrie& wordsTrie,
+                                                               const Board& board,
+                                                               std::pmr::memory_resource* resource);
+
+// Function to count how often every node is visited when solving sample boards
+// Returns hits indexed by the id of the node in the source Trie, as expected by the PackedTrie
+// constructor, so that the profile of one layout can be used to build another
+std::vector<uint64_t> profileNodeHits(const PackedTrie& wordsTrie, const std::vector<Board>& samples);
+
+#endif // BOGGLE_PACKED_H
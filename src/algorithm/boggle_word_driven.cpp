@@ -0,0 +1,134 @@
+#include "boggle_word_driven.h"
+
+namespace
+{
+// Depth-first matcher of one word around its anchor letter
+struct WordMatcher
+{
+    const Board& board;
+    const std::string& word;
+    std::vector<uint8_t>& visited;
+    size_t anchorIndex;
+    size_t anchorCell;
+
+    // word[index] has been matched at cell (marked visited); matches the rest of the word, first
+    // forwards up to its end, then backwards from the anchor down to its start
+    bool matchFrom(size_t cell, size_t index, bool forward)
+    {
+        if (forward && index + 1 == word.size())
+        {
+            // End of the word reached, continue backwards from the anchor
+            return anchorIndex == 0 || matchNext(anchorCell, anchorIndex - 1, false);
+        }
+        if (!forward && index == 0)
+        {
+            return true;
+        }
+        return matchNext(cell, forward ? index + 1 : index - 1, forward);
+    }
+
+    // Tries every unvisited neighbour of fromCell holding word[nextIndex]
+    bool matchNext(size_t fromCell, size_t nextIndex, bool forward)
+    {
+        const auto r{static_cast<int>(fromCell / board.columns)};
+        const auto c{static_cast<int>(fromCell % board.columns)};
+        for (int nextR{r - 1}; nextR <= r + 1; nextR++)
+        {
+            for (int nextC{c - 1}; nextC <= c + 1; nextC++)
+            {
+                if ((nextR < 0) || (nextR >= static_cast<int>(board.rows)) || (nextC < 0)
+                    || (nextC >= static_cast<int>(board.columns)))
+                {
+                    continue;
+                }
+
+                const auto row{static_cast<size_t>(nextR)};
+                const auto col{static_cast<size_t>(nextC)};
+                const size_t nextCell{row * board.columns + col};
+                if (visited[nextCell] != 0 || board.getLetter(row, col) != word[nextIndex])
+                {
+                    continue;
+                }
+
+                visited[nextCell] = 1;
+                const bool matched{matchFrom(nextCell, nextIndex, forward)};
+                visited[nextCell] = 0;
+
+                if (matched)
+                {
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+};
+} // namespace
+
+bool boardContainsWord(const Board& board, const LetterIndex& letterIndex, const std::string& word,
+                       std::vector<uint8_t>& visited)
+{
+    if (word.empty())
+    {
+        return false;
+    }
+
+    // Choose the letter with the fewest positions as anchor; a missing letter rules the word out
+    size_t anchorIndex{0};
+    size_t anchorCount{letterIndex.countOf(word[0])};
+    for (size_t i{1}; i < word.size() && anchorCount > 0; i++)
+    {
+        const size_t count{letterIndex.countOf(word[i])};
+        if (count < anchorCount)
+        {
+            anchorIndex = i;
+            anchorCount = count;
+        }
+    }
+    if (anchorCount == 0)
+    {
+        return false;
+    }
+
+    for (const auto anchorCell : letterIndex.positionsOf(word[anchorIndex]))
+    {
+        WordMatcher matcher{board, word, visited, anchorIndex, anchorCell};
+
+        visited[anchorCell] = 1;
+        const bool matched{matcher.matchFrom(anchorCell, anchorIndex, true)};
+        visited[anchorCell] = 0;
+
+        if (matched)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+std::vector<std::string> findValidWordsInBoardWordDriven(const std::vector<std::string>& words,
+                                                         const Board& board)
+{
+    rejectWildcards(board, "word-driven");
+
+    std::vector<std::string> wordsFound{};
+    LetterIndex letterIndex{board};
+    std::vector<uint8_t> visited(board.rows * board.columns, 0);
+
+    for (const auto& word : words)
+    {
+        if (boardContainsWord(board, letterIndex, word, visited))
+        {
+            wordsFound.push_back(word);
+        }
+    }
+
+    return wordsFound;
+}
+
+std::vector<std::string> findValidWordsInBoardWordDriven(const Trie& wordsTrie, const Board& board)
+{
+    return findValidWordsInBoardWordDriven(wordsTrie.getWords(), board);
+}
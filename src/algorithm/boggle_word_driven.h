@@ -0,0 +1,30 @@
+#ifndef BOGGLE_WORD_DRIVEN_H
+#define BOGGLE_WORD_DRIVEN_H
+
+#include "Board.h"
+#include "LetterIndex.h"
+#include "Trie.h"
+
+#include <string>
+#include <vector>
+
+// Function to check whether word can be spelled on board (adjacent cells, each used at most once)
+// The search is anchored at the positions of the word's rarest letter on the board, then extends
+// forwards to the end of the word and backwards to its start with a pruned depth-first search.
+// visited is a scratch buffer of one entry per cell, which must be all zero (and is left so).
+bool boardContainsWord(const Board& board, const LetterIndex& letterIndex, const std::string& word,
+                       std::vector<uint8_t>& visited);
+
+// Main function to find valid words in board by looking up each dictionary word
+// Instead of walking every cell path of the board, every word of the dictionary is checked with
+// boardContainsWord. This is cheaper when the dictionary is small compared to the board.
+// Each word is reported once (in dictionary order), so the result is the same set of words as
+// findValidWordsInBoardRecursive but without the duplicates of words spelled by several paths.
+// Throws std::invalid_argument if board has a blank tile (wildcardTile)
+std::vector<std::string> findValidWordsInBoardWordDriven(const std::vector<std::string>& words,
+                                                         const Board& board);
+
+// Overload taking the dictionary as a Trie (its words are listed on every call)
+std::vector<std::string> findValidWordsInBoardWordDriven(const Trie& wordsTrie, const Board& board);
+
+#endif // BOGGLE_WORD_DRIVEN_H
@@ -0,0 +1,83 @@
+#include "boggle_word_ids.h"
+
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+struct WordIdTraversal
+{
+    const WordIndex& dictionary;
+    const Board& board;
+    WordIdSet& found;
+    std::vector<uint8_t> visited{};
+
+    void visit(uint32_t node, size_t r, size_t c)
+    {
+        const uint32_t id{dictionary.wordId(node)};
+        if (id != WordIndex::noWord)
+        {
+            found.insert(id);
+        }
+
+        const size_t cell{r * board.columns + c};
+        visited[cell] = 1;
+
+        const size_t rBegin{r > 0 ? r - 1 : 0};
+        const size_t cBegin{c > 0 ? c - 1 : 0};
+        const size_t rEnd{r + 1 < board.rows ? r + 1 : r};
+        const size_t cEnd{c + 1 < board.columns ? c + 1 : c};
+        for (size_t nextR{rBegin}; nextR <= rEnd; nextR++)
+        {
+            for (size_t nextC{cBegin}; nextC <= cEnd; nextC++)
+            {
+                if (visited[nextR * board.columns + nextC] != 0)
+                {
+                    continue;
+                }
+
+                const uint32_t child{
+                    dictionary.trie().findChild(node, board.getLetter(nextR, nextC))};
+                if (child != PackedTrie::noNode)
+                {
+                    visit(child, nextR, nextC);
+                }
+            }
+        }
+
+        visited[cell] = 0;
+    }
+};
+} // namespace
+
+WordIdSet findValidWordIdsInBoard(const WordIndex& dictionary, const Board& board)
+{
+    WordIdSet found{dictionary};
+    findValidWordIdsInBoard(dictionary, board, found);
+    return found;
+}
+
+void findValidWordIdsInBoard(const WordIndex& dictionary, const Board& board, WordIdSet& found)
+{
+    rejectWildcards(board, "word-ids");
+
+    if (&found.dictionary() != &dictionary)
+    {
+        throw std::invalid_argument("The result set uses another dictionary");
+    }
+
+    WordIdTraversal traversal{dictionary, board, found};
+    traversal.visited.assign(board.rows * board.columns, 0);
+    for (size_t r{0}; r < board.rows; r++)
+    {
+        for (size_t c{0}; c < board.columns; c++)
+        {
+            const uint32_t start{
+                dictionary.trie().findChild(PackedTrie::rootIndex, board.getLetter(r, c))};
+            if (start != PackedTrie::noNode)
+            {
+                traversal.visit(start, r, c);
+            }
+        }
+    }
+}
@@ -0,0 +1,19 @@
+#ifndef BOGGLE_WORD_IDS_H
+#define BOGGLE_WORD_IDS_H
+
+#include "Board.h"
+#include "WordIdSet.h"
+#include "WordIndex.h"
+
+// Main function to find the distinct valid words in board as ids of the dictionary
+// The traversal is the one of findValidWordsInBoardRecursive on the dictionary's packed trie, but
+// a word found is only a bit set in the result: no string is built, copied or compared, and a word
+// spelled by several paths is stored once.
+// Throws std::invalid_argument if board has a blank tile (wildcardTile)
+WordIdSet findValidWordIdsInBoard(const WordIndex& dictionary, const Board& board);
+
+// Overload adding the words of board to found, e.g. to collect the words of several boards
+// Throws std::invalid_argument if found uses another dictionary or board has a blank tile
+void findValidWordIdsInBoard(const WordIndex& dictionary, const Board& board, WordIdSet& found);
+
+#endif // BOGGLE_WORD_IDS_H
@@ -1,5 +1,6 @@
 #include "Board.h"
 
+#include <algorithm>
 #include <vector>
 
 char Board::getLetter(size_t row, size_t col) const
@@ -7,3 +8,8 @@ char Board::getLetter(size_t row, size_t col) const
     // Don't use vector.at() for efficiency
     return table[row * columns + col]; // row-major
 }
+
+bool Board::hasWildcard() const
+{
+    return std::find(table.begin(), table.end(), wildcardTile) != table.end();
+}
@@ -1,17 +1,42 @@
 #ifndef BOARD_H
 #define BOARD_H
 
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <vector>
 
+// Blank tile, which stands for any letter
+// The packed solver, the path solver (findWordPathsInBoard) and the count-only solves step into
+// every child of the trie at such a cell; the other solvers throw std::invalid_argument for boards
+// which have one. Alphabet never gives its code to a symbol.
+constexpr char wildcardTile{'?'};
+
 struct Board
 {
-    std::vector<char> table{}; // row-major
+    std::vector<char> table{}; // row-major; letters, or Alphabet codes for non-ASCII boards
     size_t rows{0};
     size_t columns{0};
     // TODO: use static_assert to assert that number of rows and columns can fit into the size_t
 
     // Function to get letter at row and col from Board
     char getLetter(size_t row, size_t col) const;
+
+    // Function to check whether the board has a blank tile
+    bool hasWildcard() const;
 };
 
+// Function for the solvers which don't support blank tiles: throws std::invalid_argument naming
+// the solver if board (a Board or ZOrderBoard) has one
+template <typename BoardType>
+void rejectWildcards(const BoardType& board, std::string_view solverName)
+{
+    if (board.hasWildcard())
+    {
+        throw std::invalid_argument("The " + std::string(solverName)
+                                    + " solver doesn't support blank tiles");
+    }
+}
+
 #endif // BOARD_H
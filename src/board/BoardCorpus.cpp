@@ -0,0 +1,289 @@
+#include "BoardCorpus.h"
+
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define BOGGLE_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+constexpr char corpusMagic[8]{'B', 'O', 'G', 'C', 'O', 'R', 'P', '1'};
+constexpr size_t headerSize{32};
+constexpr size_t bitsPerLetter{5};
+
+// Function to store the low bytes of value at out, least significant first
+void putLittleEndian(unsigned char* out, uint64_t value, size_t bytes)
+{
+    for (size_t i{0}; i < bytes; i++)
+    {
+        out[i] = static_cast<unsigned char>(value >> (8 * i));
+    }
+}
+
+uint64_t getLittleEndian(const unsigned char* in, size_t bytes)
+{
+    uint64_t value{0};
+    for (size_t i{bytes}; i > 0; i--)
+    {
+        value = value << 8 | in[i - 1];
+    }
+    return value;
+}
+
+size_t recordBytes(size_t cells, uint32_t flags)
+{
+    return (flags & board_corpus::packedLetters) != 0 ? (cells * bitsPerLetter + 7) / 8 : cells;
+}
+} // namespace
+
+BoardCorpusWriter::BoardCorpusWriter(const std::string& path, size_t rows, size_t columns,
+                                     bool packLetters, bool withTimestamps)
+    : m_path(path), m_rows(rows), m_columns(columns),
+      m_flags((packLetters ? board_corpus::packedLetters : 0u)
+              | (withTimestamps ? board_corpus::timestamps : 0u))
+{
+    if (rows == 0 || columns == 0 || rows > std::numeric_limits<uint16_t>::max()
+        || columns > std::numeric_limits<uint16_t>::max())
+    {
+        throw std::invalid_argument("Board corpus boards must have 1 to 65535 rows and columns");
+    }
+    m_record.resize(recordBytes(rows * columns, m_flags));
+
+    m_file.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_file)
+    {
+        throw std::runtime_error("Cannot create board corpus " + path);
+    }
+    // Placeholder, rewritten by finish with the board count
+    const std::vector<char> header(headerSize, '\0');
+    m_file.write(header.data(), static_cast<std::streamsize>(header.size()));
+}
+
+BoardCorpusWriter::~BoardCorpusWriter()
+{
+    try
+    {
+        finish();
+    }
+    catch (const std::exception&)
+    {
+        // Destructors must not throw; call finish to see the error
+    }
+}
+
+void BoardCorpusWriter::add(const Board& board, uint64_t timestampNs)
+{
+    if (board.rows != m_rows || board.columns != m_columns)
+    {
+        throw std::invalid_argument("Board size doesn't match the board corpus");
+    }
+
+    if ((m_flags & board_corpus::packedLetters) != 0)
+    {
+        std::fill(m_record.begin(), m_record.end(), '\0');
+        size_t bit{0};
+        for (size_t r{0}; r < m_rows; r++)
+        {
+            for (size_t c{0}; c < m_columns; c++, bit += bitsPerLetter)
+            {
+                const char letter{board.getLetter(r, c)};
+                if (letter < 'A' || letter > 'Z')
+                {
+                    throw std::invalid_argument("Only letters A-Z can be packed in a board corpus");
+                }
+                // A letter spans at most two bytes
+                const auto value = static_cast<unsigned>(letter - 'A') << (bit % 8);
+                char& low = m_record[bit / 8];
+                low = static_cast<char>(static_cast<unsigned char>(low) | (value & 0xffu));
+                if ((value >> 8) != 0)
+                {
+                    m_record[bit / 8 + 1] = static_cast<char>(value >> 8);
+                }
+            }
+        }
+    }
+    else
+    {
+        for (size_t r{0}; r < m_rows; r++)
+        {
+            for (size_t c{0}; c < m_columns; c++)
+            {
+                m_record[r * m_columns + c] = board.getLetter(r, c);
+            }
+        }
+    }
+
+    m_file.write(m_record.data(), static_cast<std::streamsize>(m_record.size()));
+    if ((m_flags & board_corpus::timestamps) != 0)
+    {
+        m_timestamps.push_back(timestampNs);
+    }
+    m_boardCount++;
+}
+
+void BoardCorpusWriter::finish()
+{
+    if (m_finished)
+    {
+        return;
+    }
+    m_finished = true;
+
+    std::vector<unsigned char> bytes(m_timestamps.size() * sizeof(uint64_t));
+    for (size_t i{0}; i < m_timestamps.size(); i++)
+    {
+        putLittleEndian(&bytes[i * sizeof(uint64_t)], m_timestamps[i], sizeof(uint64_t));
+    }
+    m_file.write(reinterpret_cast<const char*>(bytes.data()),
+                 static_cast<std::streamsize>(bytes.size()));
+
+    unsigned char header[headerSize]{};
+    std::memcpy(header, corpusMagic, sizeof(corpusMagic));
+    putLittleEndian(header + 8, m_rows, 2);
+    putLittleEndian(header + 10, m_columns, 2);
+    putLittleEndian(header + 12, m_flags, 4);
+    putLittleEndian(header + 16, m_record.size(), 4);
+    putLittleEndian(header + 20, m_boardCount, 8);
+    m_file.seekp(0);
+    m_file.write(reinterpret_cast<const char*>(header), headerSize);
+    m_file.close();
+    if (!m_file)
+    {
+        throw std::runtime_error("Cannot write board corpus " + m_path);
+    }
+}
+
+BoardCorpus::BoardCorpus(const std::string& path)
+{
+#ifdef BOGGLE_HAS_MMAP
+    const int fd{open(path.c_str(), O_RDONLY)};
+    struct stat status
+    {
+    };
+    if (fd < 0 || fstat(fd, &status) != 0)
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        throw std::runtime_error("Cannot open board corpus " + path);
+    }
+    m_sizeBytes = static_cast<size_t>(status.st_size);
+    if (m_sizeBytes > 0)
+    {
+        void* mapping{mmap(nullptr, m_sizeBytes, PROT_READ, MAP_PRIVATE, fd, 0)};
+        if (mapping != MAP_FAILED)
+        {
+            m_data = static_cast<const unsigned char*>(mapping);
+            m_mapped = true;
+        }
+    }
+    close(fd);
+#endif
+    if (!m_mapped)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            throw std::runtime_error("Cannot open board corpus " + path);
+        }
+        m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        m_data = m_buffer.data();
+        m_sizeBytes = m_buffer.size();
+    }
+
+    // The destructor doesn't run when the constructor throws
+    auto invalid = [this, &path](const std::string& reason)
+    {
+        unmap();
+        return std::runtime_error("Invalid board corpus " + path + ": " + reason);
+    };
+    if (m_sizeBytes < headerSize || std::memcmp(m_data, corpusMagic, sizeof(corpusMagic)) != 0)
+    {
+        throw invalid("bad header");
+    }
+    m_rows = getLittleEndian(m_data + 8, 2);
+    m_columns = getLittleEndian(m_data + 10, 2);
+    m_flags = static_cast<uint32_t>(getLittleEndian(m_data + 12, 4));
+    m_bytesPerBoard = getLittleEndian(m_data + 16, 4);
+    m_boardCount = getLittleEndian(m_data + 20, 8);
+    if (m_rows == 0 || m_columns == 0
+        || m_bytesPerBoard != recordBytes(m_rows * m_columns, m_flags))
+    {
+        throw invalid("bad dimensions");
+    }
+    const size_t perBoard{m_bytesPerBoard + (hasTimestamps() ? sizeof(uint64_t) : 0)};
+    if (m_boardCount > (m_sizeBytes - headerSize) / perBoard
+        || headerSize + m_boardCount * perBoard != m_sizeBytes)
+    {
+        throw invalid("size doesn't match the board count");
+    }
+}
+
+BoardCorpus::~BoardCorpus()
+{
+    unmap();
+}
+
+void BoardCorpus::unmap()
+{
+#ifdef BOGGLE_HAS_MMAP
+    if (m_mapped)
+    {
+        munmap(const_cast<unsigned char*>(m_data), m_sizeBytes);
+        m_mapped = false;
+        m_data = nullptr;
+    }
+#endif
+}
+
+void BoardCorpus::decode(size_t index, Board& board) const
+{
+    const unsigned char* record{m_data + headerSize + index * m_bytesPerBoard};
+    const size_t cells{m_rows * m_columns};
+    board.rows = m_rows;
+    board.columns = m_columns;
+    board.table.resize(cells);
+    if ((m_flags & board_corpus::packedLetters) == 0)
+    {
+        std::memcpy(board.table.data(), record, cells);
+        return;
+    }
+
+    for (size_t cell{0}, bit{0}; cell < cells; cell++, bit += bitsPerLetter)
+    {
+        unsigned value{static_cast<unsigned>(record[bit / 8]) >> (bit % 8)};
+        if (bit % 8 > 8 - bitsPerLetter)
+        {
+            value |= static_cast<unsigned>(record[bit / 8 + 1]) << (8 - bit % 8);
+        }
+        board.table[cell] = static_cast<char>('A' + (value & 0x1fu));
+    }
+}
+
+Board BoardCorpus::board(size_t index) const
+{
+    Board board;
+    decode(index, board);
+    return board;
+}
+
+uint64_t BoardCorpus::timestampNs(size_t index) const
+{
+    if (!hasTimestamps())
+    {
+        return 0;
+    }
+    return getLittleEndian(m_data + headerSize + m_boardCount * m_bytesPerBoard
+                               + index * sizeof(uint64_t),
+                           sizeof(uint64_t));
+}
@@ -0,0 +1,136 @@
+#ifndef BOARDCORPUS_H
+#define BOARDCORPUS_H
+
+#include "Board.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Binary file of boards of one size, for reproducible benchmarks and replaying recorded traffic
+// Layout (little-endian):
+// - header (32 bytes): magic "BOGCORP1", rows and columns (uint16 each), flags (uint32), bytes per
+//   board (uint32), board count (uint64), 4 reserved bytes
+// - board count records of bytes per board each: the letters in row-major order, 5 bits each
+//   ('A' + value) with flag packedLetters, or one byte each without it
+// - with flag timestamps, a uint64 per board: nanoseconds since the first board was recorded
+namespace board_corpus
+{
+constexpr uint32_t packedLetters{1u << 0};
+constexpr uint32_t timestamps{1u << 1};
+} // namespace board_corpus
+
+// Writer of a board corpus
+// Boards are appended to the file as they come; the timestamps and the final board count are
+// written by finish (or the destructor).
+class BoardCorpusWriter
+{
+private:
+    std::ofstream m_file{};
+    std::string m_path{};
+    size_t m_rows{0};
+    size_t m_columns{0};
+    uint32_t m_flags{0};
+    uint64_t m_boardCount{0};
+    std::vector<uint64_t> m_timestamps{};
+    std::vector<char> m_record{};
+    bool m_finished{false};
+
+public:
+    BoardCorpusWriter() = delete;
+
+    // Constructor creating the file at path for boards of rows x columns
+    // packLetters stores 5 bits per letter, which then must all be 'A'-'Z'
+    // Throws std::invalid_argument for an empty or too large size, std::runtime_error if the file
+    // can't be created
+    BoardCorpusWriter(const std::string& path, size_t rows, size_t columns, bool packLetters,
+                      bool withTimestamps);
+
+    BoardCorpusWriter(const BoardCorpusWriter&) = delete;
+    BoardCorpusWriter& operator=(const BoardCorpusWriter&) = delete;
+
+    ~BoardCorpusWriter();
+
+    // Function to append a board, recorded timestampNs after the first one (ignored without
+    // timestamps)
+    // Throws std::invalid_argument if the board has another size or a letter can't be packed
+    void add(const Board& board, uint64_t timestampNs = 0);
+
+    // Function to write the timestamps and the header and close the file
+    // Throws std::runtime_error if writing fails
+    void finish();
+
+    uint64_t boardCount() const
+    {
+        return m_boardCount;
+    }
+};
+
+// Read-only view of a board corpus file, memory-mapped where the platform allows it (read into
+// memory otherwise)
+class BoardCorpus
+{
+private:
+    const unsigned char* m_data{nullptr};
+    size_t m_sizeBytes{0};
+    std::vector<unsigned char> m_buffer{}; // file contents, when not mapped
+    bool m_mapped{false};
+    size_t m_rows{0};
+    size_t m_columns{0};
+    uint32_t m_flags{0};
+    size_t m_bytesPerBoard{0};
+    size_t m_boardCount{0};
+
+    void unmap();
+
+public:
+    BoardCorpus() = delete;
+
+    // Constructor opening the corpus at path
+    // Throws std::runtime_error if the file can't be read or isn't a valid corpus
+    explicit BoardCorpus(const std::string& path);
+
+    BoardCorpus(const BoardCorpus&) = delete;
+    BoardCorpus& operator=(const BoardCorpus&) = delete;
+
+    ~BoardCorpus();
+
+    size_t size() const
+    {
+        return m_boardCount;
+    }
+
+    size_t rows() const
+    {
+        return m_rows;
+    }
+
+    size_t columns() const
+    {
+        return m_columns;
+    }
+
+    bool hasTimestamps() const
+    {
+        return (m_flags & board_corpus::timestamps) != 0;
+    }
+
+    size_t fileSizeBytes() const
+    {
+        return m_sizeBytes;
+    }
+
+    // Function to decode board index into board, reusing its table
+    void decode(size_t index, Board& board) const;
+
+    // Function to get board index
+    Board board(size_t index) const;
+
+    // Function to get when board index was recorded, in nanoseconds after the first board (0
+    // without timestamps)
+    uint64_t timestampNs(size_t index) const;
+};
+
+#endif // BOARDCORPUS_H
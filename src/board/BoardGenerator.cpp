@@ -0,0 +1,192 @@
+#include "BoardGenerator.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+namespace
+{
+uint64_t splitMix64(uint64_t& state)
+{
+    uint64_t value{state += 0x9E3779B97F4A7C15ULL};
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+uint64_t rotateLeft(uint64_t value, int shift)
+{
+    return (value << shift) | (value >> (64 - shift));
+}
+
+constexpr size_t boardsPerChunk{1024};
+
+size_t nativeSize(DiceSet diceSet)
+{
+    return diceSet == DiceSet::classic4x4 ? 4 : (diceSet == DiceSet::bigBoggle5x5 ? 5 : 6);
+}
+} // namespace
+
+FastRandom::FastRandom(uint64_t seed)
+{
+    for (auto& word : m_state)
+    {
+        word = splitMix64(seed);
+    }
+}
+
+uint64_t FastRandom::next()
+{
+    const uint64_t result{rotateLeft(m_state[1] * 5, 7) * 9};
+    const uint64_t shifted{m_state[1] << 17};
+
+    m_state[2] ^= m_state[0];
+    m_state[3] ^= m_state[1];
+    m_state[1] ^= m_state[2];
+    m_state[0] ^= m_state[3];
+    m_state[2] ^= shifted;
+    m_state[3] = rotateLeft(m_state[3], 45);
+
+    return result;
+}
+
+uint32_t FastRandom::below(uint32_t bound)
+{
+    // Lemire's multiply-shift with rejection, unbiased
+    uint64_t product{(next() >> 32) * bound};
+    auto low{static_cast<uint32_t>(product)};
+    if (low < bound)
+    {
+        const uint32_t threshold{(0u - bound) % bound};
+        while (low < threshold)
+        {
+            product = (next() >> 32) * bound;
+            low = static_cast<uint32_t>(product);
+        }
+    }
+    return static_cast<uint32_t>(product >> 32);
+}
+
+const std::vector<std::string_view>& getDice(DiceSet diceSet)
+{
+    static const std::vector<std::string_view> classic{
+        "AAEEGN", "ABBJOO", "ACHOPS", "AFFKPS", "AOOTTW", "CIMOTU", "DEILRX", "DELRVY",
+        "DISTTY", "EEGHNW", "EEINSU", "EHRTVW", "EIOSST", "ELRTTY", "HIMNUQ", "HLNNRZ"};
+
+    static const std::vector<std::string_view> bigBoggle{
+        "AAAFRS", "AAEEEE", "AAFIRS", "ADENNN", "AEEEEM", "AEEGMU", "AEGMNN", "AFIRSY", "BJKQXZ",
+        "CCENST", "CEIILT", "CEILPT", "CEIPST", "DDHNOT", "DHHLOR", "DHLNOR", "DHLNOR", "EIIITT",
+        "EMOTTT", "ENSSSU", "FIPRSY", "GORRVW", "IPRRRY", "NOOTUW", "OOOTTU"};
+
+    static const std::vector<std::string_view> superBigBoggle{
+        "AAAFRS", "AAEEEE", "AAEEOO", "AAFIRS", "ABDEIO", "ADENNN", "AEEEEM", "AEEGMU", "AEGMNN",
+        "AEILMN", "AEINOU", "AFIRSY", "AEHIQT", "BBJKXZ", "CCENST", "CDDLNN", "CEIITT", "CEIPST",
+        "CFGNUY", "DDHNOT", "DHHLOR", "DHHNOW", "DHLNOR", "EHILRS", "EIILST", "EILPST", "EIOAEU",
+        "EMTTTO", "ENSSSU", "GORRVW", "HIRSTV", "HOPRST", "IPRSYY", "JKQWXZ", "NOOTUW", "OOOTTU"};
+
+    switch (diceSet)
+    {
+    case DiceSet::bigBoggle5x5:
+        return bigBoggle;
+    case DiceSet::superBigBoggle6x6:
+        return superBigBoggle;
+    case DiceSet::classic4x4:
+    default:
+        return classic;
+    }
+}
+
+BoardGenerator::BoardGenerator(DiceSet diceSet, uint64_t seed)
+    : BoardGenerator(diceSet, nativeSize(diceSet), nativeSize(diceSet), seed)
+{
+}
+
+BoardGenerator::BoardGenerator(DiceSet diceSet, size_t rows, size_t columns, uint64_t seed)
+    : m_dice(getDice(diceSet)), m_rows(rows), m_columns(columns), m_random(seed)
+{
+    m_diceOrder.resize(rows * columns);
+    for (size_t cell{0}; cell < m_diceOrder.size(); cell++)
+    {
+        m_diceOrder[cell] = static_cast<uint16_t>(cell % m_dice.size());
+    }
+}
+
+void BoardGenerator::roll(std::span<char> letters)
+{
+    // Fisher-Yates shuffle of the dice, continuing from the previous board's order
+    for (size_t i{m_diceOrder.size()}; i > 1; i--)
+    {
+        std::swap(m_diceOrder[i - 1], m_diceOrder[m_random.below(static_cast<uint32_t>(i))]);
+    }
+
+    for (size_t cell{0}; cell < m_diceOrder.size(); cell++)
+    {
+        letters[cell] = m_dice[m_diceOrder[cell]][m_random.below(6)];
+    }
+}
+
+Board BoardGenerator::next()
+{
+    Board board;
+    board.rows = m_rows;
+    board.columns = m_columns;
+    board.table.resize(m_rows * m_columns);
+    roll(board.table);
+    return board;
+}
+
+void BoardGenerator::generate(std::span<char> buffer, size_t count)
+{
+    const size_t nCells{m_rows * m_columns};
+    if (buffer.size() < count * nCells)
+    {
+        throw std::invalid_argument("Buffer is too small for the requested number of boards");
+    }
+
+    for (size_t i{0}; i < count; i++)
+    {
+        roll(buffer.subspan(i * nCells, nCells));
+    }
+}
+
+uint64_t BoardGenerator::streamSeed(uint64_t seed, uint64_t index)
+{
+    uint64_t state{seed ^ (index * 0xD1B54A32D192ED03ULL)};
+    splitMix64(state);
+    return splitMix64(state);
+}
+
+void generateBoardsParallel(DiceSet diceSet, size_t rows, size_t columns, uint64_t seed,
+                            std::span<char> buffer, size_t count, size_t nThreads)
+{
+    const size_t nCells{rows * columns};
+    if (buffer.size() < count * nCells)
+    {
+        throw std::invalid_argument("Buffer is too small for the requested number of boards");
+    }
+
+    const size_t nChunks{(count + boardsPerChunk - 1) / boardsPerChunk};
+    auto generateChunks = [&](size_t firstChunk)
+    {
+        for (size_t chunk{firstChunk}; chunk < nChunks; chunk += nThreads)
+        {
+            BoardGenerator generator(diceSet, rows, columns,
+                                     BoardGenerator::streamSeed(seed, chunk));
+            const size_t first{chunk * boardsPerChunk};
+            const size_t chunkSize{std::min(boardsPerChunk, count - first)};
+            generator.generate(buffer.subspan(first * nCells, chunkSize * nCells), chunkSize);
+        }
+    };
+
+    nThreads = std::max<size_t>(1, std::min(nThreads, nChunks));
+    std::vector<std::thread> threads;
+    for (size_t t{1}; t < nThreads; t++)
+    {
+        threads.emplace_back(generateChunks, t);
+    }
+    generateChunks(0);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+}
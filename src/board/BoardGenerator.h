@@ -0,0 +1,97 @@
+#ifndef BOARDGENERATOR_H
+#define BOARDGENERATOR_H
+
+#include "Board.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <vector>
+
+// Small, fast, seedable pseudo-random generator (xoshiro256**, seeded through splitmix64)
+// Not thread-safe: use one per thread (see BoardGenerator::streamSeed for independent seeds)
+class FastRandom
+{
+private:
+    std::array<uint64_t, 4> m_state{};
+
+public:
+    explicit FastRandom(uint64_t seed);
+
+    uint64_t next();
+
+    // Function to get a uniformly distributed number in [0, bound), bound > 0
+    uint32_t below(uint32_t bound);
+};
+
+// Dice sets of the commercial games
+// Each die is a string of its 6 faces. "Qu" faces are represented by 'Q', as on our boards.
+// The 6x6 set follows Super Big Boggle, with multi-letter faces reduced to their first letter and
+// the blank faces of its die with blanks (listed as "EIOAEU") replaced by vowels.
+enum class DiceSet
+{
+    classic4x4,
+    bigBoggle5x5,
+    superBigBoggle6x6
+};
+
+const std::vector<std::string_view>& getDice(DiceSet diceSet);
+
+// Generator of random boards rolled from a dice set
+// For every board the dice are shuffled over the cells and each one shows a random face. Boards
+// larger than the dice set use it several times. The same seed always produces the same boards.
+class BoardGenerator
+{
+private:
+    const std::vector<std::string_view>& m_dice;
+    size_t m_rows{0};
+    size_t m_columns{0};
+    FastRandom m_random;
+    std::vector<uint16_t> m_diceOrder{}; // die of every cell, reshuffled for every board
+
+public:
+    BoardGenerator() = delete;
+
+    // Constructor for the native size of the dice set (4x4, 5x5 or 6x6)
+    BoardGenerator(DiceSet diceSet, uint64_t seed);
+
+    // Constructor for boards of any size, using the dice set as many times as needed
+    BoardGenerator(DiceSet diceSet, size_t rows, size_t columns, uint64_t seed);
+
+    BoardGenerator(const BoardGenerator&) = delete;
+    BoardGenerator& operator=(const BoardGenerator&) = delete;
+
+    size_t rows() const
+    {
+        return m_rows;
+    }
+
+    size_t columns() const
+    {
+        return m_columns;
+    }
+
+    // Function to roll the letters of one board into letters (rows * columns chars, row-major)
+    void roll(std::span<char> letters);
+
+    // Function to create the next board
+    Board next();
+
+    // Function to roll count boards into a preallocated buffer, board after board
+    // Throws std::invalid_argument if buffer is smaller than count * rows * columns
+    void generate(std::span<char> buffer, size_t count);
+
+    // Function to derive the seed of stream number index from a seed, for independent generators
+    // (one per thread or per chunk of boards)
+    static uint64_t streamSeed(uint64_t seed, uint64_t index);
+};
+
+// Function to roll count boards into a preallocated buffer using nThreads threads
+// Boards are generated in fixed-size chunks, each with its own stream seed, so the output only
+// depends on the seed, not on the number of threads
+void generateBoardsParallel(DiceSet diceSet, size_t rows, size_t columns, uint64_t seed,
+                            std::span<char> buffer, size_t count, size_t nThreads);
+
+#endif // BOARDGENERATOR_H
@@ -0,0 +1,51 @@
+#include "LetterIndex.h"
+
+namespace
+{
+size_t bucketOf(char letter)
+{
+    return static_cast<unsigned char>(letter);
+}
+} // namespace
+
+LetterIndex::LetterIndex(const Board& board) : m_cells(board.rows * board.columns)
+{
+    // Counting sort of the cells by letter
+    for (size_t r{0}; r < board.rows; r++)
+    {
+        for (size_t c{0}; c < board.columns; c++)
+        {
+            m_offsets[bucketOf(board.getLetter(r, c)) + 1]++;
+        }
+    }
+    for (size_t i{1}; i < m_offsets.size(); i++)
+    {
+        m_offsets[i] += m_offsets[i - 1];
+    }
+
+    std::array<uint32_t, 256> next{};
+    for (size_t i{0}; i < next.size(); i++)
+    {
+        next[i] = m_offsets[i];
+    }
+    for (size_t r{0}; r < board.rows; r++)
+    {
+        for (size_t c{0}; c < board.columns; c++)
+        {
+            m_cells[next[bucketOf(board.getLetter(r, c))]++]
+                = static_cast<uint32_t>(r * board.columns + c);
+        }
+    }
+}
+
+std::span<const uint32_t> LetterIndex::positionsOf(char letter) const
+{
+    const size_t bucket{bucketOf(letter)};
+    return {m_cells.data() + m_offsets[bucket], m_offsets[bucket + 1] - m_offsets[bucket]};
+}
+
+size_t LetterIndex::countOf(char letter) const
+{
+    const size_t bucket{bucketOf(letter)};
+    return m_offsets[bucket + 1] - m_offsets[bucket];
+}
@@ -0,0 +1,37 @@
+#ifndef LETTERINDEX_H
+#define LETTERINDEX_H
+
+#include "Board.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// Index of the cells of a Board by letter
+// Cells (row-major indices) of each letter are stored contiguously, grouped by letter in one array,
+// so looking up where a letter appears and how often costs no search of the board.
+// The index is a snapshot: it must be rebuilt if the board changes.
+// It is kept apart from Board so that Board stays a plain row-major value, cheap for the generators
+// and the solve cache to copy and transform; only the word-driven solver looks letters up, and it
+// builds the index once per solve.
+class LetterIndex
+{
+private:
+    std::array<uint32_t, 257> m_offsets{}; // start of each letter's cells, indexed by unsigned char
+    std::vector<uint32_t> m_cells{};
+
+public:
+    LetterIndex() = delete;
+
+    explicit LetterIndex(const Board& board);
+
+    // Function to get the cells containing letter, in row-major order
+    std::span<const uint32_t> positionsOf(char letter) const;
+
+    // Function to get the number of cells containing letter
+    size_t countOf(char letter) const;
+};
+
+#endif // LETTERINDEX_H
@@ -0,0 +1,77 @@
+#include "ZOrderBoard.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+
+namespace
+{
+// Function to spread the bits of x to the even bit positions (bit i to bit 2i)
+uint64_t spreadBits(uint64_t x)
+{
+    x &= 0xffffffffULL;
+    x = (x | (x << 16)) & 0x0000ffff0000ffffULL;
+    x = (x | (x << 8)) & 0x00ff00ff00ff00ffULL;
+    x = (x | (x << 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    x = (x | (x << 2)) & 0x3333333333333333ULL;
+    x = (x | (x << 1)) & 0x5555555555555555ULL;
+    return x;
+}
+} // namespace
+
+ZOrderBoard::ZOrderBoard(const Board& board) : rows(board.rows), columns(board.columns)
+{
+    if (rows == 0 || columns == 0)
+    {
+        return;
+    }
+
+    // Side of the blocks: the smaller dimension rounded up to a power of two
+    const size_t side{std::bit_ceil(std::min(rows, columns))};
+    const size_t longer{std::max(rows, columns)};
+    table.assign((longer + side - 1) / side * side * side, '\0');
+
+    // Morton code of (row, col) within its block: row bits at odd positions, column bits at even
+    // ones; the offset of the block goes with the dimension along which blocks are laid
+    rowOffsets.resize(rows);
+    for (size_t r{0}; r < rows; r++)
+    {
+        rowOffsets[r] = static_cast<size_t>(spreadBits(r & (side - 1)) << 1)
+                        + (rows > columns ? r / side * side * side : 0);
+    }
+    columnOffsets.resize(columns);
+    for (size_t c{0}; c < columns; c++)
+    {
+        columnOffsets[c] = static_cast<size_t>(spreadBits(c & (side - 1)))
+                           + (rows > columns ? 0 : c / side * side * side);
+    }
+
+    for (size_t r{0}; r < rows; r++)
+    {
+        for (size_t c{0}; c < columns; c++)
+        {
+            table[cellIndex(r, c)] = board.getLetter(r, c);
+        }
+    }
+}
+
+bool ZOrderBoard::hasWildcard() const
+{
+    return std::find(table.begin(), table.end(), wildcardTile) != table.end();
+}
+
+Board ZOrderBoard::toBoard() const
+{
+    Board board;
+    board.rows = rows;
+    board.columns = columns;
+    board.table.reserve(rows * columns);
+    for (size_t r{0}; r < rows; r++)
+    {
+        for (size_t c{0}; c < columns; c++)
+        {
+            board.table.push_back(getLetter(r, c));
+        }
+    }
+    return board;
+}
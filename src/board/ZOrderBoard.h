@@ -0,0 +1,48 @@
+#ifndef ZORDERBOARD_H
+#define ZORDERBOARD_H
+
+#include "Board.h"
+
+#include <cstddef>
+#include <vector>
+
+// Copy of a Board with its letters in Z-order
+// The table is square blocks of side 2^k (the smaller dimension rounded up to a power of two), one
+// after another along the larger dimension, with the cells of each block in Morton (Z-)order, so
+// that the neighbours of a cell are mostly close to it in memory in every direction. The table is
+// padded to whole blocks. Per-row and per-column offsets are precomputed, so getLetter is two loads
+// and an add. It is a separate type, for the solvers templated on the board type (recursive,
+// iterative and packed), so that Board stays row-major and its callers pay nothing for the layout.
+struct ZOrderBoard
+{
+    std::vector<char> table{};
+    size_t rows{0};
+    size_t columns{0};
+    // The index of the cell at row and col is rowOffsets[row] + columnOffsets[col]
+    std::vector<size_t> rowOffsets{};
+    std::vector<size_t> columnOffsets{};
+
+    ZOrderBoard() = delete;
+
+    explicit ZOrderBoard(const Board& board);
+
+    // Function to get letter at row and col
+    char getLetter(size_t row, size_t col) const
+    {
+        return table[rowOffsets[row] + columnOffsets[col]];
+    }
+
+    // Function to get the index in table of the cell at row and col
+    size_t cellIndex(size_t row, size_t col) const
+    {
+        return rowOffsets[row] + columnOffsets[col];
+    }
+
+    // Function to check whether the board has a blank tile
+    bool hasWildcard() const;
+
+    // Function to get the board back in row-major order
+    Board toBoard() const;
+};
+
+#endif // ZORDERBOARD_H
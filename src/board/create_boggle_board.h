@@ -4,15 +4,15 @@
 #include <vector>
 
 // Returns a random letter from the alphabet
+// The generator is per thread; use BoardGenerator for reproducible boards from real dice
 inline char getRandomLetter(double vowelProbability = 0.35)
 {
     static const std::string vowels = "AEIOU";
     static const std::string consonants = "BCDFGHJKLMNPQRSTVWXYZ";
-    static std::random_device rd;
-    static std::mt19937 gen(rd());
-    static std::uniform_int_distribution<std::size_t> vowelDist(0, vowels.size() - 1);
-    static std::uniform_int_distribution<std::size_t> consonantDist(0, consonants.size() - 1);
-    static std::uniform_real_distribution<double> vowelChance(0.0, 1.0);
+    thread_local std::mt19937 gen(std::random_device{}());
+    thread_local std::uniform_int_distribution<std::size_t> vowelDist(0, vowels.size() - 1);
+    thread_local std::uniform_int_distribution<std::size_t> consonantDist(0, consonants.size() - 1);
+    thread_local std::uniform_real_distribution<double> vowelChance(0.0, 1.0);
 
     return (vowelChance(gen) < vowelProbability) ? vowels[vowelDist(gen)]
                                                  : consonants[consonantDist(gen)];
@@ -0,0 +1,156 @@
+#include "BoardSymmetry.h"
+
+#include <algorithm>
+#include <tuple>
+
+namespace
+{
+// Mixing step of splitmix64, used to combine the packed words into a hash
+uint64_t mixHash(uint64_t value)
+{
+    value += 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+bool isUppercaseLetter(char letter)
+{
+    return letter >= 'A' && letter <= 'Z';
+}
+
+// Packs the letters of board in the order given by canonicalToCell
+std::vector<uint64_t> packLetters(const Board& board, const std::vector<size_t>& canonicalToCell,
+                                  uint8_t bitsPerLetter)
+{
+    const size_t lettersPerWord{size_t{64} / bitsPerLetter};
+    std::vector<uint64_t> packed((canonicalToCell.size() + lettersPerWord - 1) / lettersPerWord, 0);
+
+    for (size_t i{0}; i < canonicalToCell.size(); i++)
+    {
+        const char letter{board.table[canonicalToCell[i]]};
+        const uint64_t code{bitsPerLetter == 5
+                                ? static_cast<uint64_t>(letter - 'A' + 1)
+                                : static_cast<uint64_t>(static_cast<unsigned char>(letter))};
+
+        // Fill each word from its most significant bits so that comparing words compares letters
+        const size_t shift{64 - size_t{bitsPerLetter} * (i % lettersPerWord + 1)};
+        packed[i / lettersPerWord] |= code << shift;
+    }
+
+    return packed;
+}
+} // namespace
+
+bool swapsAxes(BoardSymmetry symmetry)
+{
+    return symmetry == BoardSymmetry::rotate90 || symmetry == BoardSymmetry::rotate270
+           || symmetry == BoardSymmetry::transpose || symmetry == BoardSymmetry::antiTranspose;
+}
+
+size_t transformCellIndex(BoardSymmetry symmetry, size_t cellIndex, size_t rows, size_t columns)
+{
+    const size_t r{cellIndex / columns};
+    const size_t c{cellIndex % columns};
+    const size_t newColumns{swapsAxes(symmetry) ? rows : columns};
+
+    size_t newR{r};
+    size_t newC{c};
+    switch (symmetry)
+    {
+    case BoardSymmetry::identity:
+        break;
+    case BoardSymmetry::rotate90:
+        newR = c;
+        newC = rows - 1 - r;
+        break;
+    case BoardSymmetry::rotate180:
+        newR = rows - 1 - r;
+        newC = columns - 1 - c;
+        break;
+    case BoardSymmetry::rotate270:
+        newR = columns - 1 - c;
+        newC = r;
+        break;
+    case BoardSymmetry::flipHorizontal:
+        newC = columns - 1 - c;
+        break;
+    case BoardSymmetry::flipVertical:
+        newR = rows - 1 - r;
+        break;
+    case BoardSymmetry::transpose:
+        newR = c;
+        newC = r;
+        break;
+    case BoardSymmetry::antiTranspose:
+        newR = columns - 1 - c;
+        newC = rows - 1 - r;
+        break;
+    }
+
+    return newR * newColumns + newC;
+}
+
+Board applySymmetry(const Board& board, BoardSymmetry symmetry)
+{
+    Board transformed;
+    transformed.rows = swapsAxes(symmetry) ? board.columns : board.rows;
+    transformed.columns = swapsAxes(symmetry) ? board.rows : board.columns;
+    transformed.table.resize(board.table.size());
+
+    for (size_t i{0}; i < board.table.size(); i++)
+    {
+        transformed.table[transformCellIndex(symmetry, i, board.rows, board.columns)]
+            = board.table[i];
+    }
+
+    return transformed;
+}
+
+CanonicalBoard canonicalizeBoard(const Board& board)
+{
+    const size_t nCells{board.rows * board.columns};
+    const uint8_t bitsPerLetter{
+        std::all_of(board.table.begin(), board.table.end(), isUppercaseLetter) ? uint8_t{5}
+                                                                                : uint8_t{8}};
+
+    CanonicalBoard best;
+    std::vector<size_t> cellToCandidate(nCells);
+    std::vector<size_t> candidateToCell(nCells);
+    bool first{true};
+
+    for (const auto symmetry : ALL_BOARD_SYMMETRIES)
+    {
+        for (size_t i{0}; i < nCells; i++)
+        {
+            cellToCandidate[i] = transformCellIndex(symmetry, i, board.rows, board.columns);
+            candidateToCell[cellToCandidate[i]] = i;
+        }
+
+        BoardKey candidate;
+        candidate.rows = swapsAxes(symmetry) ? board.columns : board.rows;
+        candidate.columns = swapsAxes(symmetry) ? board.rows : board.columns;
+        candidate.bitsPerLetter = bitsPerLetter;
+        candidate.packedLetters = packLetters(board, candidateToCell, bitsPerLetter);
+
+        if (first
+            || std::tie(candidate.rows, candidate.packedLetters)
+                   < std::tie(best.key.rows, best.key.packedLetters))
+        {
+            best.key = std::move(candidate);
+            best.symmetry = symmetry;
+            best.cellToCanonical = cellToCandidate;
+            best.canonicalToCell = candidateToCell;
+            first = false;
+        }
+    }
+
+    uint64_t hash{mixHash(best.key.rows * 0x10000 + best.key.columns * 0x100 + bitsPerLetter)};
+    for (const auto word : best.key.packedLetters)
+    {
+        hash = mixHash(hash ^ word);
+    }
+    best.key.hash = hash;
+
+    return best;
+}
@@ -0,0 +1,77 @@
+#ifndef BOARDSYMMETRY_H
+#define BOARDSYMMETRY_H
+
+#include "Board.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// The 8 symmetries of a rectangular grid (the dihedral group of the square)
+// Adjacency is preserved by all of them, so a board and its transformed copy contain the same words.
+// Rotations are clockwise. The symmetries which swap the axes turn an R x C board into a C x R one.
+enum class BoardSymmetry : uint8_t
+{
+    identity,
+    rotate90,
+    rotate180,
+    rotate270,
+    flipHorizontal, // mirror columns
+    flipVertical,   // mirror rows
+    transpose,      // mirror along the main diagonal
+    antiTranspose   // mirror along the anti-diagonal
+};
+
+constexpr std::array<BoardSymmetry, 8> ALL_BOARD_SYMMETRIES
+    = {BoardSymmetry::identity,       BoardSymmetry::rotate90,     BoardSymmetry::rotate180,
+       BoardSymmetry::rotate270,      BoardSymmetry::flipHorizontal, BoardSymmetry::flipVertical,
+       BoardSymmetry::transpose,      BoardSymmetry::antiTranspose};
+
+// Whether the symmetry turns an R x C board into a C x R one
+bool swapsAxes(BoardSymmetry symmetry);
+
+// Function to map a row-major cell index of a rows x columns board to its row-major index in the
+// transformed board
+size_t transformCellIndex(BoardSymmetry symmetry, size_t cellIndex, size_t rows, size_t columns);
+
+// Function to create the transformed copy of a board
+Board applySymmetry(const Board& board, BoardSymmetry symmetry);
+
+// Orientation-independent key of a board
+// Letters are packed (5 bits each when the board only contains 'A'-'Z', 8 bits otherwise) in the
+// canonical orientation, which is the lexicographically smallest packing among all 8 symmetries
+struct BoardKey
+{
+    size_t rows{0};
+    size_t columns{0};
+    uint8_t bitsPerLetter{0};
+    std::vector<uint64_t> packedLetters{};
+    uint64_t hash{0};
+
+    bool operator==(const BoardKey& other) const = default;
+};
+
+struct BoardKeyHash
+{
+    size_t operator()(const BoardKey& key) const
+    {
+        return static_cast<size_t>(key.hash);
+    }
+};
+
+// Result of canonicalizing a board
+// symmetry transforms the caller's board into the canonical orientation; cellToCanonical and
+// canonicalToCell are the corresponding maps of row-major cell indices
+struct CanonicalBoard
+{
+    BoardKey key{};
+    BoardSymmetry symmetry{BoardSymmetry::identity};
+    std::vector<size_t> cellToCanonical{};
+    std::vector<size_t> canonicalToCell{};
+};
+
+// Function to compute the canonical key of a board and the symmetry that produced it
+CanonicalBoard canonicalizeBoard(const Board& board);
+
+#endif // BOARDSYMMETRY_H
@@ -0,0 +1,187 @@
+#include "SolveCache.h"
+
+#include <chrono>
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+uint64_t nanosecondsSince(Clock::time_point start)
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count());
+}
+
+// Remaps the cells of every path with the given cell index map
+std::vector<WordPath> remapPaths(const std::vector<WordPath>& wordPaths,
+                                 const std::vector<size_t>& cellMap)
+{
+    std::vector<WordPath> remapped{wordPaths};
+    for (auto& wordPath : remapped)
+    {
+        for (auto& cell : wordPath.cells)
+        {
+            cell = cellMap[cell];
+        }
+    }
+    return remapped;
+}
+} // namespace
+
+double SolveCacheStats::hitRate() const
+{
+    const auto lookups{hits + misses};
+    return lookups == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+double SolveCacheStats::meanLookupMicroseconds() const
+{
+    const auto lookups{hits + misses};
+    return lookups == 0 ? 0.0 : static_cast<double>(lookupNanoseconds) / 1000.0
+                                    / static_cast<double>(lookups);
+}
+
+double SolveCacheStats::meanSolveMicroseconds() const
+{
+    return misses == 0 ? 0.0 : static_cast<double>(solveNanoseconds) / 1000.0
+                                   / static_cast<double>(misses);
+}
+
+size_t SolveCache::KeyHash::operator()(const Key& key) const
+{
+    return static_cast<size_t>(key.board.hash ^ (key.dictionaryVersion * 0x9E3779B97F4A7C15ULL));
+}
+
+SolveCache::SolveCache(size_t capacity)
+    : m_capacityPerShard((capacity + nShards - 1) / nShards > 0 ? (capacity + nShards - 1) / nShards
+                                                                : 1)
+{
+}
+
+SolveCache::Shard& SolveCache::shardFor(const Key& key)
+{
+    // Use the high bits, the low ones are used by the unordered_map buckets
+    return m_shards[(KeyHash{}(key) >> 56) % nShards];
+}
+
+SolveCache::Value SolveCache::find(const Key& key)
+{
+    Shard& shard = shardFor(key);
+    std::lock_guard lock(shard.mutex);
+
+    auto it = shard.index.find(key);
+    if (it == shard.index.end())
+    {
+        return nullptr;
+    }
+
+    // Move the entry to the front of the LRU list
+    shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+    return it->second->second;
+}
+
+void SolveCache::store(const Key& key, Value value)
+{
+    Shard& shard = shardFor(key);
+    std::lock_guard lock(shard.mutex);
+
+    auto it = shard.index.find(key);
+    if (it != shard.index.end())
+    {
+        it->second->second = std::move(value);
+        shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+        return;
+    }
+
+    if (shard.entries.size() >= m_capacityPerShard)
+    {
+        shard.index.erase(shard.entries.back().first);
+        shard.entries.pop_back();
+        m_evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    shard.entries.emplace_front(key, std::move(value));
+    shard.index.emplace(key, shard.entries.begin());
+    m_insertions.fetch_add(1, std::memory_order_relaxed);
+}
+
+std::optional<std::vector<WordPath>> SolveCache::lookup(const Board& board,
+                                                        uint64_t dictionaryVersion)
+{
+    const auto start{Clock::now()};
+
+    auto canonical = canonicalizeBoard(board);
+    auto value = find({std::move(canonical.key), dictionaryVersion});
+
+    std::optional<std::vector<WordPath>> result{};
+    if (value)
+    {
+        result = remapPaths(*value, canonical.canonicalToCell);
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    m_lookupNanoseconds.fetch_add(nanosecondsSince(start), std::memory_order_relaxed);
+    return result;
+}
+
+void SolveCache::insert(const Board& board, uint64_t dictionaryVersion,
+                        const std::vector<WordPath>& wordPaths)
+{
+    auto canonical = canonicalizeBoard(board);
+    store({std::move(canonical.key), dictionaryVersion},
+          std::make_shared<const std::vector<WordPath>>(
+              remapPaths(wordPaths, canonical.cellToCanonical)));
+}
+
+std::vector<WordPath> SolveCache::solve(const Trie& wordsTrie, uint64_t dictionaryVersion,
+                                        const Board& board)
+{
+    if (auto cached = lookup(board, dictionaryVersion))
+    {
+        return std::move(*cached);
+    }
+
+    const auto start{Clock::now()};
+    auto wordPaths = findWordPathsInBoard(wordsTrie, board);
+    m_solveNanoseconds.fetch_add(nanosecondsSince(start), std::memory_order_relaxed);
+
+    insert(board, dictionaryVersion, wordPaths);
+    return wordPaths;
+}
+
+void SolveCache::clear()
+{
+    for (auto& shard : m_shards)
+    {
+        std::lock_guard lock(shard.mutex);
+        shard.index.clear();
+        shard.entries.clear();
+    }
+}
+
+size_t SolveCache::size()
+{
+    size_t total{0};
+    for (auto& shard : m_shards)
+    {
+        std::lock_guard lock(shard.mutex);
+        total += shard.entries.size();
+    }
+    return total;
+}
+
+SolveCacheStats SolveCache::stats() const
+{
+    SolveCacheStats snapshot;
+    snapshot.hits = m_hits.load(std::memory_order_relaxed);
+    snapshot.misses = m_misses.load(std::memory_order_relaxed);
+    snapshot.insertions = m_insertions.load(std::memory_order_relaxed);
+    snapshot.evictions = m_evictions.load(std::memory_order_relaxed);
+    snapshot.lookupNanoseconds = m_lookupNanoseconds.load(std::memory_order_relaxed);
+    snapshot.solveNanoseconds = m_solveNanoseconds.load(std::memory_order_relaxed);
+    return snapshot;
+}
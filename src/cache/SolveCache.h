@@ -0,0 +1,116 @@
+#ifndef SOLVECACHE_H
+#define SOLVECACHE_H
+
+#include "Board.h"
+#include "BoardSymmetry.h"
+#include "Trie.h"
+#include "boggle_algorithm.h"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+// Snapshot of the counters of a SolveCache
+struct SolveCacheStats
+{
+    uint64_t hits{0};
+    uint64_t misses{0};
+    uint64_t insertions{0};
+    uint64_t evictions{0};
+    uint64_t lookupNanoseconds{0}; // total time spent in lookups (including path remapping)
+    uint64_t solveNanoseconds{0};  // total time spent solving boards that missed the cache
+
+    double hitRate() const;
+    double meanLookupMicroseconds() const;
+    double meanSolveMicroseconds() const;
+};
+
+// Bounded, thread-safe LRU cache of solve results
+// Boards are keyed by their canonical orientation (see canonicalizeBoard) and by a caller-provided
+// dictionary version, so that all 8 rotations/reflections of a board share one entry. Results are
+// stored with paths in the canonical orientation and remapped to the caller's orientation on
+// lookup. The cache is split into shards, each with its own lock and LRU list, to reduce
+// contention between threads.
+class SolveCache
+{
+private:
+    struct Key
+    {
+        BoardKey board{};
+        uint64_t dictionaryVersion{0};
+
+        bool operator==(const Key& other) const = default;
+    };
+
+    struct KeyHash
+    {
+        size_t operator()(const Key& key) const;
+    };
+
+    using Value = std::shared_ptr<const std::vector<WordPath>>;
+    using LruList = std::list<std::pair<Key, Value>>;
+
+    struct Shard
+    {
+        std::mutex mutex{};
+        LruList entries{}; // most recently used first
+        std::unordered_map<Key, LruList::iterator, KeyHash> index{};
+    };
+
+    static constexpr size_t nShards{16};
+
+    size_t m_capacityPerShard{0};
+    std::array<Shard, nShards> m_shards{};
+
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+    std::atomic<uint64_t> m_insertions{0};
+    std::atomic<uint64_t> m_evictions{0};
+    std::atomic<uint64_t> m_lookupNanoseconds{0};
+    std::atomic<uint64_t> m_solveNanoseconds{0};
+
+    Shard& shardFor(const Key& key);
+
+    // Function to find the canonical result of a key and mark it as most recently used
+    Value find(const Key& key);
+
+    // Function to insert a canonical result, evicting the least recently used entry if needed
+    void store(const Key& key, Value value);
+
+public:
+    SolveCache() = delete;
+
+    // Constructor with the maximum number of cached boards (at least one per shard is kept)
+    explicit SolveCache(size_t capacity);
+
+    SolveCache(const SolveCache&) = delete;
+    SolveCache& operator=(const SolveCache&) = delete;
+
+    // Function to look up the result of a board, with paths in the board's own orientation
+    std::optional<std::vector<WordPath>> lookup(const Board& board, uint64_t dictionaryVersion);
+
+    // Function to store the result of solving board (paths in the board's own orientation)
+    void insert(const Board& board, uint64_t dictionaryVersion,
+                const std::vector<WordPath>& wordPaths);
+
+    // Function to return the cached result of a board, solving it with findWordPathsInBoard on a
+    // miss. dictionaryVersion must change whenever the contents of wordsTrie change.
+    std::vector<WordPath> solve(const Trie& wordsTrie, uint64_t dictionaryVersion,
+                                const Board& board);
+
+    // Function to drop all entries (counters are kept)
+    void clear();
+
+    size_t size();
+
+    SolveCacheStats stats() const;
+};
+
+#endif // SOLVECACHE_H
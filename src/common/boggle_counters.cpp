@@ -0,0 +1,38 @@
+#include "boggle_counters.h"
+
+#include <algorithm>
+#include <ostream>
+
+SolveCounters& threadSolveCounters()
+{
+    thread_local SolveCounters counters;
+    return counters;
+}
+
+void resetSolveCounters()
+{
+    threadSolveCounters() = SolveCounters{};
+}
+
+size_t countDuplicateWords(const std::vector<std::string>& wordsFound)
+{
+    std::vector<std::string> sortedWords{wordsFound};
+    std::sort(sortedWords.begin(), sortedWords.end());
+    const auto nDistinct = static_cast<size_t>(
+        std::unique(sortedWords.begin(), sortedWords.end()) - sortedWords.begin());
+    return wordsFound.size() - nDistinct;
+}
+
+void printSolveCounters(std::ostream& out, const SolveCounters& counters)
+{
+    if (!solveCountersEnabled)
+    {
+        out << "counters disabled (configure with -DBOGGLE_ENABLE_COUNTERS=ON)\n";
+        return;
+    }
+
+    out << "cells expanded " << counters.cellsExpanded << ", trie steps " << counters.trieSteps
+        << ", prefix rejections " << counters.prefixRejections << ", words "
+        << counters.wordsEmitted << ", duplicates " << counters.duplicates << ", max depth "
+        << counters.maxDepth << "\n";
+}
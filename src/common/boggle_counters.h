@@ -0,0 +1,55 @@
+#ifndef BOGGLE_COUNTERS_H
+#define BOGGLE_COUNTERS_H
+
+#include <cstddef>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+// Hot-path counters of the BoggleDictionary traversals (the Recursive and Iterative solvers) and
+// Trie::contains
+// They are only collected when the project is configured with -DBOGGLE_ENABLE_COUNTERS=ON;
+// otherwise the BOGGLE_COUNT macros compile to nothing and the counters stay zero. Counters are per
+// thread and accumulate until reset, so reset them before a solve to get the numbers of that solve.
+struct SolveCounters
+{
+    size_t cellsExpanded{0};    // cells added to a path (their word is a prefix in the trie)
+    size_t trieSteps{0};        // child lookups in the trie
+    size_t prefixRejections{0}; // cells rejected because their word isn't a prefix in the trie
+    size_t wordsEmitted{0};     // words reported, once per path
+    size_t duplicates{0};       // words reported more than once by the same solve
+    size_t maxDepth{0};         // longest path
+};
+
+#if defined(BOGGLE_ENABLE_COUNTERS) && BOGGLE_ENABLE_COUNTERS
+inline constexpr bool solveCountersEnabled{true};
+#else
+inline constexpr bool solveCountersEnabled{false};
+#endif
+
+// Function to get the counters of the calling thread
+SolveCounters& threadSolveCounters();
+
+// Function to reset the counters of the calling thread
+void resetSolveCounters();
+
+// Function to count the words of a solve result which repeat an earlier word
+size_t countDuplicateWords(const std::vector<std::string>& wordsFound);
+
+// Function to print counters on one line (or a note that counters are disabled)
+void printSolveCounters(std::ostream& out, const SolveCounters& counters);
+
+#if defined(BOGGLE_ENABLE_COUNTERS) && BOGGLE_ENABLE_COUNTERS
+#define BOGGLE_COUNT(counter, amount) (threadSolveCounters().counter += (amount))
+#define BOGGLE_COUNT_MAX(counter, value)                                                           \
+    do                                                                                             \
+    {                                                                                              \
+        auto& boggleCounter = threadSolveCounters().counter;                                       \
+        boggleCounter = boggleCounter < (value) ? (value) : boggleCounter;                         \
+    } while (false)
+#else
+#define BOGGLE_COUNT(counter, amount) ((void)0)
+#define BOGGLE_COUNT_MAX(counter, value) ((void)0)
+#endif
+
+#endif // BOGGLE_COUNTERS_H
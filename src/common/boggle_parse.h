@@ -0,0 +1,32 @@
+#ifndef BOGGLE_PARSE_H
+#define BOGGLE_PARSE_H
+
+#include <charconv>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+// Function to parse the whole of text as a number; returns false if it isn't one or is out of range
+template <typename Number>
+bool parseNumber(std::string_view text, Number& value)
+{
+    const auto [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    return error == std::errc{} && end == text.data() + text.size();
+}
+
+// Function to parse the value of a command line option as a number
+// Throws std::invalid_argument if it isn't one
+template <typename Number>
+Number parseOption(std::string_view option, std::string_view text)
+{
+    Number value{};
+    if (!parseNumber(text, value))
+    {
+        throw std::invalid_argument("Invalid value for " + std::string(option) + ": "
+                                    + std::string(text));
+    }
+    return value;
+}
+
+#endif // BOGGLE_PARSE_H
@@ -1,20 +1,546 @@
 #include "Board.h"
+#include "BoardCorpus.h"
+#include "BoardGenerator.h"
+#include "PackedTrie.h"
+#include "SharedDictionary.h"
 #include "Trie.h"
 #include "VisitMap.h"
 #include "boggle_algorithm.h"
+#include "boggle_counters.h"
+#include "boggle_parse.h"
+#include "boggle_pipeline.h"
+#include "boggle_supervisor.h"
 #include "boggle_tester.h"
 #include "create_boggle_board.h"
+#include "word_list.h"
 
 #include <algorithm> // For std::sort
-#include <chrono>    // For performance measurement
+#include <chrono> // For performance measurement
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <memory>
+#include <optional>
 #include <set> // For std::set
+#include <sstream>
+#include <stdexcept>
+#include <string>
 #include <string_view>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
-int main()
+namespace
 {
+void printSupervisorUsage()
+{
+    std::cout << "Usage: boggle_solver --supervisor [--workers N] [--boards N] [--size RxC]\n"
+                 "                      [--batch N] [--seed N] [--dictionary FILE] [--scale]\n"
+                 "                      [--crash-after N]\n"
+                 "  --workers      worker processes (default: hardware threads)\n"
+                 "  --boards       random boards to solve (default 10000)\n"
+                 "  --size         board size (default 4x4)\n"
+                 "  --batch        boards per batch handed to a worker (default 64)\n"
+                 "  --dictionary   word list, one word per line (default: built-in list)\n"
+                 "  --scale        run with 1, 2, 4, ... workers up to --workers\n"
+                 "  --crash-after  kill worker 0 during its Nth batch, to test the restart\n";
+}
+
+void printStreamUsage()
+{
+    std::cout << "Usage: boggle_solver --stream [--input FILE] [--threads N] [--batch N]\n"
+                 "                      [--queue N] [--dictionary FILE]\n"
+                 "  --input        board file, one board per line with its rows separated by\n"
+                 "                 spaces, e.g. \"TAPS ONED RATI MSEG\" (default: stdin)\n"
+                 "  --threads      solver threads (default: hardware threads)\n"
+                 "  --batch        board lines per queue item (default 256)\n"
+                 "  --queue        batches each queue holds (default 16)\n"
+                 "  --dictionary   word list, one word per line (default: built-in list)\n"
+                 "       boggle_solver --generate N [--size RxC] [--seed N]\n"
+                 "  writes N random boards in the --stream input format to stdout\n";
+}
+
+void printRecordUsage()
+{
+    std::cout << "Usage: boggle_solver --record FILE [--boards N] [--size RxC] [--seed N]\n"
+                 "                      [--input FILE|-] [--rate N] [--live] [--raw]\n"
+                 "  writes a binary board corpus for boggle_microbench --replay\n"
+                 "  --boards       random boards to record (default 100000)\n"
+                 "  --size         random board size (default 4x4)\n"
+                 "  --input        record the boards of a --stream input file (- for stdin)\n"
+                 "                 instead; boards of another size than the first are skipped\n"
+                 "  --rate         timestamp the boards as arriving at N boards/s\n"
+                 "  --live         timestamp the input boards with their arrival times\n"
+                 "  --raw          store a byte per letter (needed for blank tiles)\n";
+}
+
+// Function to parse a "RxC" board size; returns false if it isn't one
+bool parseBoardSize(std::string_view size, size_t& rows, size_t& columns)
+{
+    const size_t separator{size.find('x')};
+    return separator != std::string_view::npos && parseNumber(size.substr(0, separator), rows)
+           && parseNumber(size.substr(separator + 1), columns);
+}
+
+// Function to get the words of the dictionary file at path, or of the built-in list if path is
+// empty; fileWords holds the words read from the file. Returns false if the file can't be read.
+bool loadWords(const std::string& path, std::vector<std::string>& fileWords,
+               std::vector<std::string_view>& words)
+{
+    words.assign(EXTENDED_WORD_LIST.begin(), EXTENDED_WORD_LIST.end());
+    if (path.empty())
+    {
+        return true;
+    }
+
+    std::ifstream file(path);
+    if (!file)
+    {
+        std::cerr << "Cannot open " << path << "\n";
+        return false;
+    }
+    for (std::string word; std::getline(file, word);)
+    {
+        if (!word.empty())
+        {
+            fileWords.push_back(word);
+        }
+    }
+    words.assign(fileWords.begin(), fileWords.end());
+    return true;
+}
+
+// Supervisor mode: solve random boards with a pool of worker processes sharing one dictionary
+int runSupervisorMode(int argc, char* argv[])
+{
+    SupervisorConfig config;
+    config.workers = std::max(1u, std::thread::hardware_concurrency());
+    bool scale{false};
+    std::string dictionaryPath;
+    for (int i{2}; i < argc; i++)
+    {
+        const std::string_view arg{argv[i]};
+        const bool hasValue{i + 1 < argc};
+        if (arg == "--workers" && hasValue)
+        {
+            config.workers = parseOption<size_t>(arg, argv[++i]);
+        }
+        else if (arg == "--boards" && hasValue)
+        {
+            config.boards = parseOption<size_t>(arg, argv[++i]);
+            if (config.boards == 0)
+            {
+                throw std::invalid_argument("Invalid value for --boards: 0");
+            }
+        }
+        else if (arg == "--size" && hasValue)
+        {
+            if (!parseBoardSize(argv[++i], config.rows, config.columns))
+            {
+                printSupervisorUsage();
+                return EXIT_FAILURE;
+            }
+        }
+        else if (arg == "--batch" && hasValue)
+        {
+            config.batchSize = parseOption<size_t>(arg, argv[++i]);
+        }
+        else if (arg == "--seed" && hasValue)
+        {
+            config.seed = parseOption<uint64_t>(arg, argv[++i]);
+        }
+        else if (arg == "--dictionary" && hasValue)
+        {
+            dictionaryPath = argv[++i];
+        }
+        else if (arg == "--scale")
+        {
+            scale = true;
+        }
+        else if (arg == "--crash-after" && hasValue)
+        {
+            config.crashAfterBatches = parseOption<size_t>(arg, argv[++i]);
+        }
+        else
+        {
+            printSupervisorUsage();
+            return arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    if (!processPoolSupported)
+    {
+        std::cerr << "Supervisor mode needs a POSIX system\n";
+        return EXIT_FAILURE;
+    }
+
+    std::vector<std::string> fileWords;
+    std::vector<std::string_view> words;
+    if (!loadWords(dictionaryPath, fileWords, words))
+    {
+        return EXIT_FAILURE;
+    }
+    // Memory a worker would need to build its own Trie
+    const size_t memoryBeforeTrie{processPrivateMemoryKb()};
+    auto ownTrie = std::make_unique<Trie>(words);
+    const size_t memoryWithTrie{processPrivateMemoryKb()};
+    const size_t ownTrieKb{memoryWithTrie > memoryBeforeTrie ? memoryWithTrie - memoryBeforeTrie
+                                                              : 0};
+    const PackedTrie wordsTrie{*ownTrie, TrieLayout::vanEmdeBoas};
+    ownTrie.reset();
+
+    std::vector<size_t> workerCounts;
+    for (size_t workers{1}; scale && workers < config.workers; workers *= 2)
+    {
+        workerCounts.push_back(workers);
+    }
+    workerCounts.push_back(config.workers);
+
+    std::cout << config.boards << " boards of " << config.rows << "x" << config.columns << ", "
+              << words.size() << " words\n"
+              << std::setw(8) << "workers" << std::setw(14) << "boards/s" << std::setw(10)
+              << "speedup" << std::setw(22) << "worker memory (KB)" << std::setw(10)
+              << "restarts\n";
+
+    std::optional<double> singleWorkerRate{};
+    for (const size_t workers : workerCounts)
+    {
+        config.workers = workers;
+        const SupervisorReport report{runSupervisor(wordsTrie, config)};
+        if (!singleWorkerRate)
+        {
+            singleWorkerRate = report.boardsPerSecond();
+            std::cout << "Shared dictionary: " << report.dictionaryBytes / 1024
+                      << " KB, mapped read-only by every worker (a Trie built by a worker: "
+                      << ownTrieKb << " KB); " << report.wordsFound << " words found\n";
+        }
+
+        // The speedup is against the first row, unless no board was solved in measurable time
+        std::ostringstream speedup;
+        if (*singleWorkerRate > 0)
+        {
+            speedup << std::fixed << std::setprecision(2)
+                    << report.boardsPerSecond() / *singleWorkerRate << "x";
+        }
+        else
+        {
+            speedup << "-";
+        }
+        std::cout << std::setw(8) << workers << std::setw(14) << std::fixed
+                  << std::setprecision(0) << report.boardsPerSecond() << std::setw(10)
+                  << speedup.str() << std::setw(22)
+                  << *std::max_element(report.workerMemoryKb.begin(), report.workerMemoryKb.end())
+                  << std::setw(10) << report.restarts << "\n";
+    }
+    return EXIT_SUCCESS;
+}
+
+// Stream mode: solve the boards of a file or stdin, writing the words of each to stdout
+int runStreamMode(int argc, char* argv[])
+{
+    PipelineConfig config;
+    config.solvers = std::max(1u, std::thread::hardware_concurrency());
+    std::string inputPath;
+    std::string dictionaryPath;
+    for (int i{2}; i < argc; i++)
+    {
+        const std::string_view arg{argv[i]};
+        const bool hasValue{i + 1 < argc};
+        if (arg == "--input" && hasValue)
+        {
+            inputPath = argv[++i];
+        }
+        else if (arg == "--threads" && hasValue)
+        {
+            config.solvers = parseOption<size_t>(arg, argv[++i]);
+        }
+        else if (arg == "--batch" && hasValue)
+        {
+            config.batchSize = parseOption<size_t>(arg, argv[++i]);
+        }
+        else if (arg == "--queue" && hasValue)
+        {
+            config.queueCapacity = parseOption<size_t>(arg, argv[++i]);
+        }
+        else if (arg == "--dictionary" && hasValue)
+        {
+            dictionaryPath = argv[++i];
+        }
+        else
+        {
+            printStreamUsage();
+            return arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+
+    std::vector<std::string> fileWords;
+    std::vector<std::string_view> words;
+    if (!loadWords(dictionaryPath, fileWords, words))
+    {
+        return EXIT_FAILURE;
+    }
+    const PackedTrie wordsTrie{Trie{words}, TrieLayout::vanEmdeBoas};
+
+    std::ifstream file;
+    if (!inputPath.empty())
+    {
+        file.open(inputPath);
+        if (!file)
+        {
+            std::cerr << "Cannot open " << inputPath << "\n";
+            return EXIT_FAILURE;
+        }
+    }
+
+    // Results go to stdout; the report goes to stderr, so that it doesn't mix with them
+    std::ios::sync_with_stdio(false);
+    const PipelineReport report{
+        runPipeline(wordsTrie, inputPath.empty() ? std::cin : file, std::cout, config)};
+    std::cerr << report.boardsSolved << " boards (" << report.invalidLines << " invalid lines) in "
+              << std::fixed << std::setprecision(3) << report.seconds << " s with "
+              << config.solvers << " solver threads: " << std::setprecision(0)
+              << report.boardsPerSecond() << " boards/s, " << report.wordsFound << " words\n";
+    return report.invalidLines == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+// Generate mode: write random boards in the format of stream mode
+int runGenerateMode(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        printStreamUsage();
+        return EXIT_FAILURE;
+    }
+    const auto nBoards = parseOption<size_t>("--generate", argv[2]);
+    size_t rows{4};
+    size_t columns{4};
+    uint64_t seed{1};
+    for (int i{3}; i < argc; i++)
+    {
+        const std::string_view arg{argv[i]};
+        const bool hasValue{i + 1 < argc};
+        if (arg == "--size" && hasValue && parseBoardSize(argv[i + 1], rows, columns))
+        {
+            i++;
+        }
+        else if (arg == "--seed" && hasValue)
+        {
+            seed = parseOption<uint64_t>(arg, argv[++i]);
+        }
+        else
+        {
+            printStreamUsage();
+            return EXIT_FAILURE;
+        }
+    }
+
+    std::ios::sync_with_stdio(false);
+    BoardGenerator generator{DiceSet::classic4x4, rows, columns, seed};
+    for (size_t i{0}; i < nBoards; i++)
+    {
+        std::cout << formatBoardLine(generator.next()) << '\n';
+    }
+    return EXIT_SUCCESS;
+}
+
+// Record mode: write generated or captured boards to a board corpus, optionally timestamped
+int runRecordMode(int argc, char* argv[])
+{
+    if (argc < 3)
+    {
+        printRecordUsage();
+        return EXIT_FAILURE;
+    }
+    const std::string corpusPath{argv[2]};
+    size_t nBoards{100000};
+    size_t rows{4};
+    size_t columns{4};
+    uint64_t seed{1};
+    std::string inputPath;
+    double rate{0};
+    bool live{false};
+    bool raw{false};
+    for (int i{3}; i < argc; i++)
+    {
+        const std::string_view arg{argv[i]};
+        const bool hasValue{i + 1 < argc};
+        if (arg == "--boards" && hasValue)
+        {
+            nBoards = parseOption<size_t>(arg, argv[++i]);
+        }
+        else if (arg == "--size" && hasValue && parseBoardSize(argv[i + 1], rows, columns))
+        {
+            i++;
+        }
+        else if (arg == "--seed" && hasValue)
+        {
+            seed = parseOption<uint64_t>(arg, argv[++i]);
+        }
+        else if (arg == "--input" && hasValue)
+        {
+            inputPath = argv[++i];
+        }
+        else if (arg == "--rate" && hasValue)
+        {
+            rate = parseOption<double>(arg, argv[++i]);
+        }
+        else if (arg == "--live")
+        {
+            live = true;
+        }
+        else if (arg == "--raw")
+        {
+            raw = true;
+        }
+        else
+        {
+            printRecordUsage();
+            return arg == "--help" ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if (rate < 0 || (live && (rate > 0 || inputPath.empty())))
+    {
+        std::cerr << "--rate must be positive; --live needs --input and can't be combined with "
+                     "--rate\n";
+        return EXIT_FAILURE;
+    }
+
+    // Nanoseconds after the first board at which board index arrives (or arrived, with --live)
+    const auto start = std::chrono::steady_clock::now();
+    auto timestampNs = [&](size_t index) -> uint64_t
+    {
+        if (live)
+        {
+            return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                             std::chrono::steady_clock::now() - start)
+                                             .count());
+        }
+        return rate > 0 ? static_cast<uint64_t>(static_cast<double>(index) * 1e9 / rate) : 0;
+    };
+
+    try
+    {
+        std::unique_ptr<BoardCorpusWriter> writer;
+        size_t skipped{0};
+        if (inputPath.empty())
+        {
+            writer = std::make_unique<BoardCorpusWriter>(corpusPath, rows, columns, !raw,
+                                                         rate > 0);
+            BoardGenerator generator{DiceSet::classic4x4, rows, columns, seed};
+            for (size_t i{0}; i < nBoards; i++)
+            {
+                writer->add(generator.next(), timestampNs(i));
+            }
+        }
+        else
+        {
+            std::ifstream file;
+            if (inputPath != "-")
+            {
+                file.open(inputPath);
+                if (!file)
+                {
+                    std::cerr << "Cannot open " << inputPath << "\n";
+                    return EXIT_FAILURE;
+                }
+            }
+            std::istream& in{inputPath == "-" ? std::cin : file};
+            for (std::string line; std::getline(in, line);)
+            {
+                if (line.empty() || line.front() == '#')
+                {
+                    continue;
+                }
+                const std::optional<Board> board{parseBoardLine(line)};
+                if (!board)
+                {
+                    skipped++;
+                    continue;
+                }
+                if (!writer)
+                {
+                    rows = board->rows;
+                    columns = board->columns;
+                    writer = std::make_unique<BoardCorpusWriter>(corpusPath, rows, columns, !raw,
+                                                                 live || rate > 0);
+                }
+                if (board->rows != rows || board->columns != columns)
+                {
+                    skipped++;
+                    continue;
+                }
+                writer->add(*board, timestampNs(writer->boardCount()));
+            }
+        }
+        if (!writer)
+        {
+            std::cerr << "No boards in " << inputPath << "\n";
+            return EXIT_FAILURE;
+        }
+        writer->finish();
+        std::cerr << writer->boardCount() << " boards of " << rows << "x" << columns
+                  << " recorded to " << corpusPath << " (" << skipped
+                  << " boards of another size or invalid skipped)\n";
+    }
+    catch (const std::exception& error)
+    {
+        std::cerr << error.what() << "\n";
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc > 1)
+    {
+        const std::string_view mode{argv[1]};
+        // Invalid option values and configurations are reported with the usage of the mode
+        try
+        {
+            if (mode == "--supervisor")
+            {
+                return runSupervisorMode(argc, argv);
+            }
+            if (mode == "--stream")
+            {
+                return runStreamMode(argc, argv);
+            }
+            if (mode == "--generate")
+            {
+                return runGenerateMode(argc, argv);
+            }
+            if (mode == "--record")
+            {
+                return runRecordMode(argc, argv);
+            }
+        }
+        catch (const std::invalid_argument& error)
+        {
+            std::cerr << error.what() << "\n";
+            if (mode == "--supervisor")
+            {
+                printSupervisorUsage();
+            }
+            else if (mode == "--record")
+            {
+                printRecordUsage();
+            }
+            else
+            {
+                printStreamUsage();
+            }
+            return EXIT_FAILURE;
+        }
+        printSupervisorUsage();
+        printStreamUsage();
+        printRecordUsage();
+        return EXIT_FAILURE;
+    }
+
     // Test case 1: few valid words, small board
 
     // List of words to search for in the Boggle board
@@ -25,12 +551,12 @@ int main()
            "NOTE", "NOTES", "TONES", "PAT",    "SAP",  "SAPS", "DENS",  "DEN",  "TEND",
            "ENDS", "NEAT",  "STEM",  "MIST",   "MATS", "PAST", "PANE"};
 
-    std::cout << "\nWords to find:" << std::endl;
+    std::cout << "\nWords to find:\n";
     for (const auto& word : wordsList)
     {
         std::cout << word << " ";
     }
-    std::cout << std::endl;
+    std::cout << "\n";
 
     // Construct Trie using words
     Trie wordsTrie{wordsList};
@@ -44,14 +570,14 @@ int main()
     // Board board = createBoggleBoard<4, 4>();
 
     // Print the board for visual reference
-    std::cout << "Boggle Board:" << std::endl;
+    std::cout << "Boggle Board:\n";
     for (size_t i = 0; i < board.rows; ++i)
     {
         for (size_t j = 0; j < board.columns; ++j)
         {
             std::cout << board.getLetter(i, j) << " ";
         }
-        std::cout << std::endl;
+        std::cout << "\n";
     }
 
     // Words that should be found in this board (the expected solution - corrected)
@@ -61,30 +587,38 @@ int main()
            "TAR", "TEAM", "TEAR", "TEARS", "TEAS", "TEN", "TONE", "TONES"};
 
     // Performance comparison between recursive and iterative methods
-    std::cout << "\n=== Performance Comparison ===" << std::endl;
+    std::cout << "\n=== Performance Comparison ===\n";
 
     // Measure recursive method performance
+    resetSolveCounters();
     auto start_recursive = std::chrono::high_resolution_clock::now();
     auto foundWordsRecursive = findValidWordsInBoardRecursive(wordsTrie, board);
     auto end_recursive = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double, std::milli> recursive_duration = end_recursive - start_recursive;
+    const SolveCounters recursiveCounters{threadSolveCounters()};
 
     // Measure iterative method performance
+    resetSolveCounters();
     auto start_iterative = std::chrono::high_resolution_clock::now();
     auto foundWordsIterative = findValidWordsInBoardIterative(wordsTrie, board);
     auto end_iterative = std::chrono::high_resolution_clock::now();
     std::chrono::duration<double, std::milli> iterative_duration = end_iterative - start_iterative;
+    const SolveCounters iterativeCounters{threadSolveCounters()};
 
     // Print performance results
-    std::cout << "Recursive method execution time: " << recursive_duration.count() << " ms"
-              << std::endl;
-    std::cout << "Iterative method execution time: " << iterative_duration.count() << " ms"
-              << std::endl;
+    std::cout << "Recursive method execution time: " << recursive_duration.count() << " ms\n";
+    std::cout << "Iterative method execution time: " << iterative_duration.count() << " ms\n";
     std::cout << "Performance ratio (Recursive/Iterative): "
-              << recursive_duration.count() / iterative_duration.count() << std::endl;
+              << recursive_duration.count() / iterative_duration.count() << "\n";
+
+    // Print the hot-path counters of both solves
+    std::cout << "Recursive method counters: ";
+    printSolveCounters(std::cout, recursiveCounters);
+    std::cout << "Iterative method counters: ";
+    printSolveCounters(std::cout, iterativeCounters);
 
     // Verify that both methods produce the same results
-    std::cout << "\n=== Method Comparison ===" << std::endl;
+    std::cout << "\n=== Method Comparison ===\n";
 
     // Sort both result sets for easier comparison
     std::sort(foundWordsRecursive.begin(), foundWordsRecursive.end());
@@ -93,15 +627,15 @@ int main()
     // Check if results are identical
     bool resultsMatch = (foundWordsRecursive == foundWordsIterative);
     std::cout << "Both methods produce identical results: " << (resultsMatch ? "YES" : "NO")
-              << std::endl;
+              << "\n";
 
     // If results don't match, show differences
     if (!resultsMatch)
     {
-        std::cout << "\nDifferences between methods:" << std::endl;
+        std::cout << "\nDifferences between methods:\n";
 
         // Find words in recursive but not in iterative
-        std::cout << "Words found by recursive but not by iterative method:" << std::endl;
+        std::cout << "Words found by recursive but not by iterative method:\n";
         std::set<std::string> recursiveSet(foundWordsRecursive.begin(), foundWordsRecursive.end());
         std::set<std::string> iterativeSet(foundWordsIterative.begin(), foundWordsIterative.end());
 
@@ -112,10 +646,10 @@ int main()
                 std::cout << word << " ";
             }
         }
-        std::cout << std::endl;
+        std::cout << "\n";
 
         // Find words in iterative but not in recursive
-        std::cout << "Words found by iterative but not by recursive method:" << std::endl;
+        std::cout << "Words found by iterative but not by recursive method:\n";
         for (const auto& word : iterativeSet)
         {
             if (recursiveSet.find(word) == recursiveSet.end())
@@ -123,23 +657,23 @@ int main()
                 std::cout << word << " ";
             }
         }
-        std::cout << std::endl;
+        std::cout << "\n";
     }
 
     // Verify only the iterative method against expected words
-    std::cout << "\n=== Verification Against Expected Words ===" << std::endl;
+    std::cout << "\n=== Verification Against Expected Words ===\n";
 
     // Print expected solution for reference
-    std::cout << "Expected solution (words that should be found):" << std::endl;
+    std::cout << "Expected solution (words that should be found):\n";
     printWords(expectedWords);
 
     // Print words found by iterative method
-    std::cout << "\nWords found by iterative method:" << std::endl;
+    std::cout << "\nWords found by iterative method:\n";
     printWords(foundWordsIterative);
 
     // Run detailed verification for iterative method only
     VerificationResult resultIterative = verifyBoggleResults(expectedWords, foundWordsIterative);
-    std::cout << "\nVerification results for iterative method:" << std::endl;
+    std::cout << "\nVerification results for iterative method:\n";
     printVerificationResults(resultIterative);
 
     return 0;
@@ -0,0 +1,102 @@
+#ifndef BOUNDEDQUEUE_H
+#define BOUNDEDQUEUE_H
+
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <semaphore>
+#include <stdexcept>
+#include <utility>
+
+// Thread-safe FIFO queue of at most capacity items, connecting the stages of a pipeline
+// push blocks while the queue is full, so a fast producer waits for its consumers (backpressure)
+// instead of buffering the whole input. Once the producer calls close, pop drains the remaining
+// items and then returns std::nullopt.
+// Waiting uses a semaphore counting the free slots and one counting the items. close releases
+// one extra count of each, which every thread it wakes up passes on to the next waiting thread.
+template <typename T>
+class BoundedQueue
+{
+private:
+    std::deque<T> m_items{};
+    size_t m_capacity{0};
+    bool m_closed{false};
+    mutable std::mutex m_mutex{};
+    std::counting_semaphore<> m_freeSlots;
+    std::counting_semaphore<> m_filledSlots{0};
+
+public:
+    BoundedQueue() = delete;
+
+    // Throws std::invalid_argument if capacity is 0 or too large for a semaphore
+    explicit BoundedQueue(size_t capacity)
+        : m_capacity(capacity), m_freeSlots(static_cast<std::ptrdiff_t>(capacity))
+    {
+        if (capacity == 0 || capacity >= static_cast<size_t>(std::counting_semaphore<>::max()))
+        {
+            throw std::invalid_argument("Bounded queue capacity out of range");
+        }
+    }
+
+    // Function to append item, waiting while the queue is full
+    // Returns false (dropping item) if the queue has been closed
+    bool push(T item)
+    {
+        m_freeSlots.acquire();
+        {
+            std::lock_guard lock{m_mutex};
+            if (!m_closed)
+            {
+                m_items.push_back(std::move(item));
+                m_filledSlots.release();
+                return true;
+            }
+        }
+        m_freeSlots.release();
+        return false;
+    }
+
+    // Function to take the oldest item, waiting while the queue is empty and open
+    std::optional<T> pop()
+    {
+        m_filledSlots.acquire();
+        {
+            std::lock_guard lock{m_mutex};
+            if (!m_items.empty())
+            {
+                std::optional<T> item{std::move(m_items.front())};
+                m_items.pop_front();
+                m_freeSlots.release();
+                return item;
+            }
+        }
+        m_filledSlots.release();
+        return std::nullopt;
+    }
+
+    // Function to stop accepting items and wake up every waiting thread
+    void close()
+    {
+        std::lock_guard lock{m_mutex};
+        if (!m_closed)
+        {
+            m_closed = true;
+            m_freeSlots.release();
+            m_filledSlots.release();
+        }
+    }
+
+    size_t size() const
+    {
+        std::lock_guard lock{m_mutex};
+        return m_items.size();
+    }
+
+    size_t capacity() const
+    {
+        return m_capacity;
+    }
+};
+
+#endif // BOUNDEDQUEUE_H
@@ -0,0 +1,75 @@
+#include "SharedDictionary.h"
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#ifdef BOGGLE_HAS_PROCESS_POOL
+#include <sys/mman.h>
+#endif
+
+namespace
+{
+struct SegmentHeader
+{
+    uint64_t magic{0};
+    uint64_t nodeCount{0};
+};
+
+constexpr uint64_t segmentMagic{0x424f47474c454431}; // "BOGGLED1"
+} // namespace
+
+#ifdef BOGGLE_HAS_PROCESS_POOL
+
+SharedDictionary::SharedDictionary(const PackedTrie& wordsTrie)
+    : m_sizeBytes(sizeof(SegmentHeader) + wordsTrie.nodeCount() * sizeof(PackedTrie::PackedNode))
+{
+    m_segment = mmap(nullptr, m_sizeBytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1,
+                     0);
+    if (m_segment == MAP_FAILED)
+    {
+        m_segment = nullptr;
+        throw std::runtime_error("Cannot map the shared dictionary");
+    }
+
+    const SegmentHeader header{segmentMagic, wordsTrie.nodeCount()};
+    std::memcpy(m_segment, &header, sizeof(header));
+    std::memcpy(static_cast<char*>(m_segment) + sizeof(header), wordsTrie.nodes().data(),
+                wordsTrie.nodeCount() * sizeof(PackedTrie::PackedNode));
+
+    // Read-only from now on, in this process and in the processes forked from it
+    if (mprotect(m_segment, m_sizeBytes, PROT_READ) != 0)
+    {
+        munmap(m_segment, m_sizeBytes);
+        m_segment = nullptr;
+        throw std::runtime_error("Cannot protect the shared dictionary");
+    }
+}
+
+SharedDictionary::~SharedDictionary()
+{
+    if (m_segment)
+    {
+        munmap(m_segment, m_sizeBytes);
+    }
+}
+
+#else
+
+SharedDictionary::SharedDictionary(const PackedTrie&)
+{
+    throw std::runtime_error("Shared dictionaries need a POSIX system");
+}
+
+SharedDictionary::~SharedDictionary() = default;
+
+#endif
+
+std::span<const PackedTrie::PackedNode> SharedDictionary::nodes() const
+{
+    SegmentHeader header;
+    std::memcpy(&header, m_segment, sizeof(header));
+    return {reinterpret_cast<const PackedTrie::PackedNode*>(static_cast<const char*>(m_segment)
+                                                            + sizeof(header)),
+            static_cast<size_t>(header.nodeCount)};
+}
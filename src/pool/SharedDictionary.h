@@ -0,0 +1,48 @@
+#ifndef SHAREDDICTIONARY_H
+#define SHAREDDICTIONARY_H
+
+#include "PackedTrie.h"
+
+#include <cstddef>
+#include <span>
+
+// Whether worker processes (fork, shared mappings) are available on this platform
+#if defined(__unix__) || defined(__APPLE__)
+#define BOGGLE_HAS_PROCESS_POOL 1
+constexpr bool processPoolSupported{true};
+#else
+constexpr bool processPoolSupported{false};
+#endif
+
+// Copy of the nodes of a PackedTrie in a shared, read-only memory mapping
+// The nodes are self-contained (children are indices, not pointers), so the mapping is usable as
+// is by every process forked after it was created: the pages are shared, not copied, and writing
+// to them faults. The segment starts with a small header (magic, node count) and is unmapped by
+// the destructor.
+class SharedDictionary
+{
+private:
+    void* m_segment{nullptr};
+    size_t m_sizeBytes{0};
+
+public:
+    SharedDictionary() = delete;
+
+    // Throws std::runtime_error if the mapping can't be created (or processPoolSupported is false)
+    explicit SharedDictionary(const PackedTrie& wordsTrie);
+
+    SharedDictionary(const SharedDictionary&) = delete;
+    SharedDictionary& operator=(const SharedDictionary&) = delete;
+
+    ~SharedDictionary();
+
+    std::span<const PackedTrie::PackedNode> nodes() const;
+
+    // Function to get the size of the segment (header and nodes)
+    size_t sizeBytes() const
+    {
+        return m_sizeBytes;
+    }
+};
+
+#endif // SHAREDDICTIONARY_H
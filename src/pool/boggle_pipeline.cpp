@@ -0,0 +1,249 @@
+#include "boggle_pipeline.h"
+
+#include "BoundedQueue.h"
+#include "boggle_packed.h"
+
+#include <algorithm>
+#include <chrono>
+#include <istream>
+#include <map>
+#include <ostream>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+// Lines read from the input, with their line numbers (for error messages)
+struct LineBatch
+{
+    size_t sequence{0};
+    std::vector<std::string> lines{};
+    std::vector<size_t> lineNumbers{};
+};
+
+// Output of a batch, formatted by the solver which solved it
+struct ResultBatch
+{
+    size_t sequence{0};
+    std::string text{};
+    size_t boardsSolved{0};
+    size_t invalidLines{0};
+    uint64_t wordsFound{0};
+};
+
+// Function to sort the words found by findBlankMarkedWordsPacked and keep one marked form of every
+// dictionary word: the first in sort order (e.g. "ANd" of "ANd" and "AnD")
+void keepOneFormPerWord(std::vector<std::string>& words)
+{
+    std::vector<std::pair<std::string, std::string>> forms; // (dictionary word, marked form)
+    forms.reserve(words.size());
+    for (auto& marked : words)
+    {
+        std::string word{marked};
+        for (char& letter : word)
+        {
+            if (letter >= 'a' && letter <= 'z')
+            {
+                letter = static_cast<char>(letter - 'a' + 'A');
+            }
+        }
+        forms.emplace_back(std::move(word), std::move(marked));
+    }
+    std::sort(forms.begin(), forms.end());
+    forms.erase(std::unique(forms.begin(), forms.end(), [](const auto& left, const auto& right)
+                            { return left.first == right.first; }),
+                forms.end());
+
+    words.clear();
+    for (auto& form : forms)
+    {
+        words.push_back(std::move(form.second));
+    }
+}
+
+// Function to solve the boards of a batch into its output text
+ResultBatch solveBatch(const PackedTrie& wordsTrie, const LineBatch& batch)
+{
+    ResultBatch result;
+    result.sequence = batch.sequence;
+    for (size_t i{0}; i < batch.lines.size(); i++)
+    {
+        const std::optional<Board> board{parseBoardLine(batch.lines[i])};
+        if (!board)
+        {
+            result.text += "# line " + std::to_string(batch.lineNumbers[i]) + ": invalid board\n";
+            result.invalidLines++;
+            continue;
+        }
+
+        auto words = findBlankMarkedWordsPacked(wordsTrie, *board);
+        if (board->hasWildcard())
+        {
+            keepOneFormPerWord(words);
+        }
+        else
+        {
+            std::sort(words.begin(), words.end());
+            words.erase(std::unique(words.begin(), words.end()), words.end());
+        }
+
+        result.text += formatBoardLine(*board);
+        result.text += ':';
+        for (const auto& word : words)
+        {
+            result.text += ' ';
+            result.text += word;
+        }
+        result.text += '\n';
+        result.boardsSolved++;
+        result.wordsFound += words.size();
+    }
+    return result;
+}
+} // namespace
+
+std::optional<Board> parseBoardLine(std::string_view line)
+{
+    Board board;
+    size_t position{0};
+    while (position < line.size())
+    {
+        const size_t rowBegin{line.find_first_not_of(" \t\r", position)};
+        if (rowBegin == std::string_view::npos)
+        {
+            break;
+        }
+        size_t rowEnd{line.find_first_of(" \t\r", rowBegin)};
+        rowEnd = rowEnd == std::string_view::npos ? line.size() : rowEnd;
+
+        const std::string_view row{line.substr(rowBegin, rowEnd - rowBegin)};
+        if ((board.rows > 0 && row.size() != board.columns)
+            || std::any_of(row.begin(), row.end(), [](char letter)
+                           { return (letter < 'A' || letter > 'Z') && letter != wildcardTile; }))
+        {
+            return std::nullopt;
+        }
+        board.columns = row.size();
+        board.rows++;
+        board.table.insert(board.table.end(), row.begin(), row.end());
+        position = rowEnd;
+    }
+
+    if (board.rows == 0)
+    {
+        return std::nullopt;
+    }
+    return board;
+}
+
+std::string formatBoardLine(const Board& board)
+{
+    std::string line;
+    line.reserve(board.rows * (board.columns + 1));
+    for (size_t r{0}; r < board.rows; r++)
+    {
+        if (r > 0)
+        {
+            line += ' ';
+        }
+        for (size_t c{0}; c < board.columns; c++)
+        {
+            line += board.getLetter(r, c);
+        }
+    }
+    return line;
+}
+
+PipelineReport runPipeline(const PackedTrie& wordsTrie, std::istream& in, std::ostream& out,
+                           const PipelineConfig& config)
+{
+    if (config.solvers == 0 || config.batchSize == 0 || config.queueCapacity == 0)
+    {
+        throw std::invalid_argument("Pipeline solvers, batch size and queue capacity must be "
+                                    "positive");
+    }
+
+    BoundedQueue<LineBatch> lineQueue{config.queueCapacity};
+    BoundedQueue<ResultBatch> resultQueue{config.queueCapacity};
+    PipelineReport report;
+    const auto start = std::chrono::steady_clock::now();
+
+    std::thread reader(
+        [&in, &lineQueue, &config]
+        {
+            LineBatch batch;
+            size_t lineNumber{0};
+            for (std::string line; std::getline(in, line);)
+            {
+                lineNumber++;
+                if (line.empty() || line.front() == '#')
+                {
+                    continue;
+                }
+                batch.lines.push_back(std::move(line));
+                batch.lineNumbers.push_back(lineNumber);
+                if (batch.lines.size() == config.batchSize)
+                {
+                    const size_t sequence{batch.sequence};
+                    lineQueue.push(std::move(batch));
+                    batch = LineBatch{sequence + 1, {}, {}};
+                }
+            }
+            if (!batch.lines.empty())
+            {
+                lineQueue.push(std::move(batch));
+            }
+            lineQueue.close();
+        });
+
+    std::vector<std::thread> solvers;
+    for (size_t i{0}; i < config.solvers; i++)
+    {
+        solvers.emplace_back(
+            [&wordsTrie, &lineQueue, &resultQueue]
+            {
+                while (std::optional<LineBatch> batch = lineQueue.pop())
+                {
+                    resultQueue.push(solveBatch(wordsTrie, *batch));
+                }
+            });
+    }
+
+    // Batches solved ahead of the next one to write wait here; at most one per solver and queue
+    // slot, since the reader can't run further ahead
+    std::thread writer(
+        [&out, &resultQueue, &report]
+        {
+            std::map<size_t, ResultBatch> pending;
+            size_t nextSequence{0};
+            while (std::optional<ResultBatch> result = resultQueue.pop())
+            {
+                pending.emplace(result->sequence, std::move(*result));
+                for (auto next = pending.find(nextSequence); next != pending.end();
+                     next = pending.find(++nextSequence))
+                {
+                    const ResultBatch& batch = next->second;
+                    out.write(batch.text.data(), static_cast<std::streamsize>(batch.text.size()));
+                    report.boardsSolved += batch.boardsSolved;
+                    report.invalidLines += batch.invalidLines;
+                    report.wordsFound += batch.wordsFound;
+                    pending.erase(next);
+                }
+            }
+            out.flush();
+        });
+
+    reader.join();
+    for (auto& solver : solvers)
+    {
+        solver.join();
+    }
+    resultQueue.close();
+    writer.join();
+
+    report.seconds
+        = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return report;
+}
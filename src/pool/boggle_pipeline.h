@@ -0,0 +1,58 @@
+#ifndef BOGGLE_PIPELINE_H
+#define BOGGLE_PIPELINE_H
+
+#include "Board.h"
+#include "PackedTrie.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+
+// Shape of a streaming pipeline run
+struct PipelineConfig
+{
+    size_t solvers{4};        // solver threads
+    size_t batchSize{256};    // board lines per queue item
+    size_t queueCapacity{16}; // batches each queue holds before its producer waits
+};
+
+// Outcome of a streaming pipeline run
+struct PipelineReport
+{
+    size_t boardsSolved{0};
+    size_t invalidLines{0};
+    uint64_t wordsFound{0}; // sum over the boards of the distinct words of each board
+    double seconds{0};      // from the first line read to the last result written
+
+    double boardsPerSecond() const
+    {
+        return seconds > 0 ? static_cast<double>(boardsSolved) / seconds : 0.0;
+    }
+};
+
+// Function to parse a board line: its rows, separated by spaces (e.g. "TAPS ONED RATI MSEG")
+// Returns std::nullopt unless there is at least one row, all rows have the same, non-zero length
+// and every letter is an uppercase 'A' to 'Z' or a blank tile (wildcardTile)
+std::optional<Board> parseBoardLine(std::string_view line);
+
+// Function to format a board as a line accepted by parseBoardLine
+std::string formatBoardLine(const Board& board);
+
+// Main function to solve a stream of boards, one per line of in (see parseBoardLine)
+// A reader thread splits the input into batches of lines, a pool of solver threads parses and
+// solves them with the packed solver, and a writer thread writes the results to out in input
+// order. The stages are connected by BoundedQueues, so the reader waits when the solvers fall
+// behind, and the writer holds back batches which finish early until the batches before them are
+// written. For every board, out gets one line, "BOARD: WORDS" with the distinct words sorted. The
+// letters taken by blank tiles, '?', are in lower case, and a word which the blanks spell in
+// several ways is listed once, with the first of its marked forms in sort order. Invalid lines
+// give "# line N: invalid board". Empty lines and lines starting with '#' are skipped. out is
+// written in large blocks and only flushed once, at the end.
+// Throws std::invalid_argument if a size of config is 0
+PipelineReport runPipeline(const PackedTrie& wordsTrie, std::istream& in, std::ostream& out,
+                           const PipelineConfig& config);
+
+#endif // BOGGLE_PIPELINE_H
@@ -0,0 +1,331 @@
+#include "boggle_supervisor.h"
+
+#include "BoardGenerator.h"
+#include "SharedDictionary.h"
+#include "boggle_packed.h"
+
+#include <stdexcept>
+
+#ifdef BOGGLE_HAS_PROCESS_POOL
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+
+#include <sys/mman.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace
+{
+constexpr size_t ringSlots{32};
+constexpr size_t maxBatchCells{64 * 1024};
+constexpr size_t maxWorkers{256};
+
+enum SlotState : uint32_t
+{
+    slotFree,
+    slotReady,
+    slotTaken,
+    slotDone
+};
+
+// A slot's state and the worker holding it share one word, so that claiming is a single CAS and a
+// batch held by a dead worker can be found
+constexpr uint32_t slotWord(SlotState state, size_t worker = 0)
+{
+    return state | static_cast<uint32_t>(worker) << 8;
+}
+
+SlotState stateOf(uint32_t word)
+{
+    return static_cast<SlotState>(word & 0xff);
+}
+
+size_t workerOf(uint32_t word)
+{
+    return word >> 8;
+}
+
+struct BatchSlot
+{
+    std::atomic<uint32_t> state{slotWord(slotFree)};
+    size_t boardCount{0};
+    uint64_t wordsFound{0};
+    std::array<char, maxBatchCells> letters{}; // boardCount boards, row-major, back to back
+};
+
+// Ring of batch slots and worker status, in a mapping shared by the supervisor and the workers
+// Atomics are lock-free, hence address-free, so they work across processes.
+struct SharedRing
+{
+    std::atomic<uint32_t> shutdown{0};
+    std::array<BatchSlot, ringSlots> slots{};
+    std::array<std::atomic<uint64_t>, maxWorkers> workerMemoryKb{};
+};
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free
+                  && std::atomic<uint64_t>::is_always_lock_free,
+              "Atomics shared between processes must be lock-free");
+
+// Body of a worker process: claims ready batches until the supervisor shuts the ring down
+[[noreturn]] void runWorker(SharedRing& ring, std::span<const PackedTrie::PackedNode> nodes,
+                            const SupervisorConfig& config, size_t worker, bool crashes)
+{
+    try
+    {
+        Board board;
+        board.rows = config.rows;
+        board.columns = config.columns;
+        board.table.resize(config.rows * config.columns);
+        const size_t cells{board.table.size()};
+
+        size_t batchesSolved{0};
+        while (ring.shutdown.load(std::memory_order_acquire) == 0)
+        {
+            bool claimed{false};
+            for (auto& slot : ring.slots)
+            {
+                uint32_t expected{slotWord(slotReady)};
+                if (!slot.state.compare_exchange_strong(expected, slotWord(slotTaken, worker),
+                                                        std::memory_order_acq_rel))
+                {
+                    continue;
+                }
+                claimed = true;
+
+                uint64_t wordsFound{0};
+                for (size_t i{0}; i < slot.boardCount; i++)
+                {
+                    if (crashes && batchesSolved + 1 == config.crashAfterBatches
+                        && i == slot.boardCount / 2)
+                    {
+                        raise(SIGKILL);
+                    }
+                    std::copy_n(slot.letters.begin() + static_cast<std::ptrdiff_t>(i * cells),
+                                cells, board.table.begin());
+                    auto words = findValidWordsInBoardPacked(nodes, board);
+                    std::sort(words.begin(), words.end());
+                    wordsFound += static_cast<uint64_t>(
+                        std::unique(words.begin(), words.end()) - words.begin());
+                }
+                slot.wordsFound = wordsFound;
+                slot.state.store(slotWord(slotDone, worker), std::memory_order_release);
+                batchesSolved++;
+            }
+            if (!claimed)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(100));
+            }
+        }
+        ring.workerMemoryKb[worker].store(processPrivateMemoryKb(), std::memory_order_relaxed);
+        _exit(0);
+    }
+    catch (...)
+    {
+        _exit(1);
+    }
+}
+} // namespace
+
+size_t processPrivateMemoryKb()
+{
+    // Pages only this process maps, so pages shared with the supervisor (copy-on-write after fork,
+    // or the dictionary) don't count
+    std::ifstream smaps("/proc/self/smaps_rollup");
+    size_t privateKb{0};
+    bool found{false};
+    for (std::string line; std::getline(smaps, line);)
+    {
+        if (line.starts_with("Private_Clean:") || line.starts_with("Private_Dirty:"))
+        {
+            privateKb += std::stoul(line.substr(line.find(':') + 1));
+            found = true;
+        }
+    }
+    if (found)
+    {
+        return privateKb;
+    }
+
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return static_cast<size_t>(usage.ru_maxrss) / 1024; // bytes on macOS
+#else
+    return static_cast<size_t>(usage.ru_maxrss);
+#endif
+}
+
+SupervisorReport runSupervisor(const PackedTrie& wordsTrie, const SupervisorConfig& config)
+{
+    const size_t cells{config.rows * config.columns};
+    if (config.workers == 0 || config.workers > maxWorkers)
+    {
+        throw std::invalid_argument("The number of workers must be 1 to 256");
+    }
+    if (cells == 0 || cells > maxBatchCells)
+    {
+        throw std::invalid_argument("Boards must have 1 to 65536 cells");
+    }
+
+    SupervisorReport report;
+    const SharedDictionary dictionary{wordsTrie};
+    report.dictionaryBytes = dictionary.sizeBytes();
+
+    void* mapping = mmap(nullptr, sizeof(SharedRing), PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+    {
+        throw std::runtime_error("Cannot map the shared board ring");
+    }
+    auto unmapRing = [](SharedRing* ring)
+    {
+        ring->~SharedRing();
+        munmap(ring, sizeof(SharedRing));
+    };
+    const std::unique_ptr<SharedRing, decltype(unmapRing)> ringOwner(new (mapping) SharedRing{},
+                                                                     unmapRing);
+    SharedRing& ring = *ringOwner;
+
+    const size_t boardsPerBatch{std::clamp<size_t>(config.batchSize, 1, maxBatchCells / cells)};
+    const size_t nBatches{(config.boards + boardsPerBatch - 1) / boardsPerBatch};
+    std::vector<pid_t> pids(config.workers, -1);
+
+    auto startWorker = [&](size_t worker, bool crashes)
+    {
+        std::cout.flush();
+        const pid_t pid{fork()};
+        if (pid < 0)
+        {
+            throw std::runtime_error("Cannot fork a worker process");
+        }
+        if (pid == 0)
+        {
+            runWorker(ring, dictionary.nodes(), config, worker, crashes);
+        }
+        pids[worker] = pid;
+    };
+
+    auto stopWorkers = [&](bool kill)
+    {
+        ring.shutdown.store(1, std::memory_order_release);
+        for (const pid_t pid : pids)
+        {
+            if (pid > 0)
+            {
+                if (kill)
+                {
+                    ::kill(pid, SIGKILL);
+                }
+                int status{0};
+                waitpid(pid, &status, 0);
+            }
+        }
+    };
+
+    const auto start = std::chrono::steady_clock::now();
+    try
+    {
+        for (size_t worker{0}; worker < config.workers; worker++)
+        {
+            startWorker(worker, config.crashAfterBatches > 0 && worker == 0);
+        }
+
+        BoardGenerator generator{DiceSet::classic4x4, config.rows, config.columns, config.seed};
+        size_t batchesQueued{0};
+        size_t batchesDone{0};
+        size_t boardsQueued{0};
+        while (batchesDone < nBatches)
+        {
+            bool progress{false};
+            for (auto& slot : ring.slots)
+            {
+                if (stateOf(slot.state.load(std::memory_order_acquire)) == slotDone)
+                {
+                    report.wordsFound += slot.wordsFound;
+                    report.boardsSolved += slot.boardCount;
+                    batchesDone++;
+                    slot.state.store(slotWord(slotFree), std::memory_order_relaxed);
+                    progress = true;
+                }
+                if (stateOf(slot.state.load(std::memory_order_relaxed)) == slotFree
+                    && batchesQueued < nBatches)
+                {
+                    slot.boardCount = std::min(boardsPerBatch, config.boards - boardsQueued);
+                    generator.generate(std::span(slot.letters.data(), slot.boardCount * cells),
+                                       slot.boardCount);
+                    boardsQueued += slot.boardCount;
+                    batchesQueued++;
+                    slot.state.store(slotWord(slotReady), std::memory_order_release);
+                    progress = true;
+                }
+            }
+
+            // Replace the workers which died, putting the batch they held back in the ring
+            for (size_t worker{0}; worker < config.workers; worker++)
+            {
+                int status{0};
+                if (waitpid(pids[worker], &status, WNOHANG) != pids[worker])
+                {
+                    continue;
+                }
+                for (auto& slot : ring.slots)
+                {
+                    const uint32_t word{slot.state.load(std::memory_order_acquire)};
+                    if (stateOf(word) == slotTaken && workerOf(word) == worker)
+                    {
+                        slot.state.store(slotWord(slotReady), std::memory_order_release);
+                    }
+                }
+                report.restarts++;
+                pids[worker] = -1;
+                startWorker(worker, false);
+                progress = true;
+            }
+
+            if (!progress)
+            {
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+            }
+        }
+    }
+    catch (...)
+    {
+        stopWorkers(true);
+        throw;
+    }
+
+    const std::chrono::duration<double> elapsed{std::chrono::steady_clock::now() - start};
+    report.seconds = elapsed.count();
+    stopWorkers(false);
+    for (size_t worker{0}; worker < config.workers; worker++)
+    {
+        report.workerMemoryKb.push_back(
+            static_cast<size_t>(ring.workerMemoryKb[worker].load(std::memory_order_relaxed)));
+    }
+    return report;
+}
+
+#else
+
+size_t processPrivateMemoryKb()
+{
+    return 0;
+}
+
+SupervisorReport runSupervisor(const PackedTrie&, const SupervisorConfig&)
+{
+    throw std::runtime_error("The supervisor needs a POSIX system (fork and shared mappings)");
+}
+
+#endif
@@ -0,0 +1,52 @@
+#ifndef BOGGLE_SUPERVISOR_H
+#define BOGGLE_SUPERVISOR_H
+
+#include "PackedTrie.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Work and shape of a supervisor run
+struct SupervisorConfig
+{
+    size_t workers{4};
+    size_t boards{10000};
+    size_t rows{4};
+    size_t columns{4};
+    size_t batchSize{64};    // boards per ring slot (fewer if the boards are large)
+    uint64_t seed{1};        // of the BoardGenerator which rolls the boards
+    size_t crashAfterBatches{0}; // if > 0, worker 0 kills itself in the middle of this batch (test)
+};
+
+// Outcome of a supervisor run
+struct SupervisorReport
+{
+    size_t boardsSolved{0};
+    uint64_t wordsFound{0}; // sum over the boards of the distinct words of each board
+    double seconds{0};
+    size_t restarts{0};     // workers which died and were replaced
+    size_t dictionaryBytes{0};
+    std::vector<size_t> workerMemoryKb{}; // private memory of the last process of each worker
+
+    double boardsPerSecond() const
+    {
+        return seconds > 0 ? static_cast<double>(boardsSolved) / seconds : 0.0;
+    }
+};
+
+// Function to get the memory of the calling process which isn't shared with other processes
+// (private pages of /proc/self/smaps_rollup, or the peak resident memory where it's unavailable)
+size_t processPrivateMemoryKb();
+
+// Main function to solve random boards with a pool of worker processes
+// The supervisor copies the dictionary once into a read-only shared mapping (SharedDictionary)
+// and forks the workers, which solve with it in place instead of building their own Trie. Boards
+// are handed out in batches through a ring of slots in another shared mapping: the supervisor
+// rolls a batch into a free slot, a worker claims it with a compare-and-swap, solves it and marks
+// it done, and the supervisor collects the word count. A worker which dies is replaced, and the
+// batch it held is put back in the ring, so every board is solved exactly once.
+// Throws std::runtime_error if processPoolSupported is false or a process can't be created.
+SupervisorReport runSupervisor(const PackedTrie& wordsTrie, const SupervisorConfig& config);
+
+#endif // BOGGLE_SUPERVISOR_H
@@ -0,0 +1,231 @@
+#include "Alphabet.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+char32_t decodeUtf8(std::string_view text, size_t& pos)
+{
+    const auto byteAt = [&text](size_t i) { return static_cast<unsigned char>(text[i]); };
+
+    const unsigned char lead{byteAt(pos)};
+    size_t length{0};
+    char32_t codePoint{0};
+    char32_t minimum{0};
+
+    if (lead < 0x80)
+    {
+        pos++;
+        return lead;
+    }
+    else if ((lead & 0xE0) == 0xC0)
+    {
+        length = 2;
+        codePoint = lead & 0x1Fu;
+        minimum = 0x80;
+    }
+    else if ((lead & 0xF0) == 0xE0)
+    {
+        length = 3;
+        codePoint = lead & 0x0Fu;
+        minimum = 0x800;
+    }
+    else if ((lead & 0xF8) == 0xF0)
+    {
+        length = 4;
+        codePoint = lead & 0x07u;
+        minimum = 0x10000;
+    }
+    else
+    {
+        throw std::invalid_argument("Invalid UTF-8 lead byte");
+    }
+
+    if (pos + length > text.size())
+    {
+        throw std::invalid_argument("Truncated UTF-8 sequence");
+    }
+
+    for (size_t i{1}; i < length; i++)
+    {
+        const unsigned char continuation{byteAt(pos + i)};
+        if ((continuation & 0xC0) != 0x80)
+        {
+            throw std::invalid_argument("Invalid UTF-8 continuation byte");
+        }
+        codePoint = (codePoint << 6) | (continuation & 0x3Fu);
+    }
+
+    if (codePoint < minimum || codePoint > 0x10FFFF
+        || (codePoint >= 0xD800 && codePoint <= 0xDFFF))
+    {
+        throw std::invalid_argument("Invalid UTF-8 code point");
+    }
+
+    pos += length;
+    return codePoint;
+}
+
+std::string encodeUtf8(char32_t codePoint)
+{
+    std::string utf8;
+    if (codePoint < 0x80)
+    {
+        utf8.push_back(static_cast<char>(codePoint));
+    }
+    else if (codePoint < 0x800)
+    {
+        utf8.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        utf8.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else if (codePoint < 0x10000)
+    {
+        utf8.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        utf8.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        utf8.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    else
+    {
+        utf8.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        utf8.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        utf8.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        utf8.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+    return utf8;
+}
+
+Alphabet::Alphabet(const std::vector<std::string_view>& words)
+{
+    buildFrom(words);
+}
+
+void Alphabet::buildFrom(const std::vector<std::string_view>& words)
+{
+    for (const auto word : words)
+    {
+        size_t pos{0};
+        while (pos < word.size())
+        {
+            m_codePoints.push_back(decodeUtf8(word, pos));
+        }
+    }
+
+    std::sort(m_codePoints.begin(), m_codePoints.end());
+    m_codePoints.erase(std::unique(m_codePoints.begin(), m_codePoints.end()), m_codePoints.end());
+
+    if (m_codePoints.size() > maxSize)
+    {
+        throw std::invalid_argument("Dictionary uses more symbols than an Alphabet can encode");
+    }
+    if (m_codePoints.size() > wildcardCode)
+    {
+        m_codePoints.insert(m_codePoints.begin() + wildcardCode, U'?');
+    }
+
+    m_asciiCodes.fill(unknownCode);
+    for (size_t code{0}; code < m_codePoints.size(); code++)
+    {
+        if (code == wildcardCode)
+        {
+            continue;
+        }
+        if (m_codePoints[code] < m_asciiCodes.size())
+        {
+            m_asciiCodes[m_codePoints[code]] = static_cast<uint8_t>(code);
+        }
+        else
+        {
+            m_codes.emplace(m_codePoints[code], static_cast<uint8_t>(code));
+        }
+    }
+}
+
+uint8_t Alphabet::codeOf(char32_t codePoint) const
+{
+    if (codePoint < m_asciiCodes.size())
+    {
+        return m_asciiCodes[codePoint];
+    }
+
+    auto it = m_codes.find(codePoint);
+    return it == m_codes.end() ? unknownCode : it->second;
+}
+
+std::string Alphabet::symbolOf(uint8_t code) const
+{
+    if (code == wildcardCode)
+    {
+        return "?";
+    }
+    if (code >= m_codePoints.size())
+    {
+        throw std::out_of_range("Code is not part of the alphabet");
+    }
+    return encodeUtf8(m_codePoints[code]);
+}
+
+std::string Alphabet::encode(std::string_view utf8) const
+{
+    std::string encoded;
+    encoded.reserve(utf8.size());
+
+    size_t pos{0};
+    while (pos < utf8.size())
+    {
+        encoded.push_back(static_cast<char>(codeOf(decodeUtf8(utf8, pos))));
+    }
+    return encoded;
+}
+
+std::string Alphabet::decode(std::string_view encoded) const
+{
+    std::string utf8;
+    utf8.reserve(encoded.size());
+
+    for (const char code : encoded)
+    {
+        utf8 += symbolOf(static_cast<uint8_t>(code));
+    }
+    return utf8;
+}
+
+std::vector<std::string> Alphabet::encodeWords(const std::vector<std::string_view>& words) const
+{
+    std::vector<std::string> encodedWords;
+    encodedWords.reserve(words.size());
+    for (const auto word : words)
+    {
+        encodedWords.push_back(encode(word));
+    }
+    return encodedWords;
+}
+
+std::vector<std::string> Alphabet::decodeWords(const std::vector<std::string>& encodedWords) const
+{
+    std::vector<std::string> words;
+    words.reserve(encodedWords.size());
+    for (const auto& encodedWord : encodedWords)
+    {
+        words.push_back(decode(encodedWord));
+    }
+    return words;
+}
+
+Board Alphabet::encodeBoard(size_t rows, size_t columns, std::string_view utf8Symbols) const
+{
+    Board board;
+    board.rows = rows;
+    board.columns = columns;
+
+    size_t pos{0};
+    while (pos < utf8Symbols.size())
+    {
+        const char32_t codePoint{decodeUtf8(utf8Symbols, pos)};
+        board.table.push_back(codePoint == U'?' ? wildcardTile
+                                                : static_cast<char>(codeOf(codePoint)));
+    }
+    if (board.table.size() != rows * columns)
+    {
+        throw std::invalid_argument("Number of board symbols does not match the dimensions");
+    }
+    return board;
+}
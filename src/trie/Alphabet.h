@@ -0,0 +1,89 @@
+#ifndef ALPHABET_H
+#define ALPHABET_H
+
+#include "Board.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Function to decode the UTF-8 code point starting at text[pos], advancing pos past it
+// Throws std::invalid_argument on malformed UTF-8 (truncated, overlong, surrogate or out of range)
+char32_t decodeUtf8(std::string_view text, size_t& pos);
+
+// Function to encode a code point as UTF-8
+std::string encodeUtf8(char32_t codePoint);
+
+// Dense encoding of the symbols used by a dictionary
+// Every distinct symbol (Unicode code point, e.g. 'A', 'Ä', 'Ñ', 'Σ') of the dictionary gets a small
+// code 0, 1, ..., codeCount() - 1, in increasing code point order (so sorting encoded words sorts
+// them like their UTF-8 form). Encoded words and boards store one code per char, so every solver
+// works on them unchanged and a multi-byte symbol costs the same as an ASCII letter. Symbols that
+// are not in the dictionary are encoded as unknownCode, which matches no word.
+// wildcardCode, the char of a blank tile, is reserved: symbols skip it, so alphabets of more than
+// wildcardCode symbols have one code more than symbols. '?' on a board stands for a blank tile.
+class Alphabet
+{
+public:
+    static constexpr size_t maxSize{254};
+    static constexpr uint8_t unknownCode{255};
+    static constexpr auto wildcardCode = static_cast<uint8_t>(wildcardTile);
+
+private:
+    std::vector<char32_t> m_codePoints{};           // by code ('?' at wildcardCode)
+    std::array<uint8_t, 128> m_asciiCodes{};        // fast path for ASCII symbols
+    std::unordered_map<char32_t, uint8_t> m_codes{}; // other symbols
+
+    void buildFrom(const std::vector<std::string_view>& words);
+
+public:
+    Alphabet() = delete;
+
+    // Constructor from the words of a dictionary (UTF-8)
+    // Throws std::invalid_argument if the words use more than maxSize symbols
+    explicit Alphabet(const std::vector<std::string_view>& words);
+
+    template <size_t N>
+    explicit Alphabet(const std::array<std::string_view, N>& words)
+    {
+        buildFrom(std::vector<std::string_view>(words.begin(), words.end()));
+    }
+
+    // Number of symbols
+    size_t size() const
+    {
+        return m_codePoints.size() - (m_codePoints.size() > wildcardCode ? 1 : 0);
+    }
+
+    // One more than the largest code of a symbol
+    size_t codeCount() const
+    {
+        return m_codePoints.size();
+    }
+
+    // Function to get the code of a symbol (unknownCode if not in the alphabet)
+    uint8_t codeOf(char32_t codePoint) const;
+
+    // Function to get the UTF-8 symbol of a code
+    std::string symbolOf(uint8_t code) const;
+
+    // Function to encode UTF-8 text, one char (the code) per symbol
+    std::string encode(std::string_view utf8) const;
+
+    // Function to decode encoded text back to UTF-8
+    std::string decode(std::string_view encoded) const;
+
+    std::vector<std::string> encodeWords(const std::vector<std::string_view>& words) const;
+    std::vector<std::string> decodeWords(const std::vector<std::string>& encodedWords) const;
+
+    // Function to create an encoded board from its symbols in row-major order (UTF-8, one symbol
+    // per cell, '?' for a blank tile). Throws std::invalid_argument if the number of symbols isn't
+    // rows * columns.
+    Board encodeBoard(size_t rows, size_t columns, std::string_view utf8Symbols) const;
+};
+
+#endif // ALPHABET_H
@@ -0,0 +1,52 @@
+#include "MultiTrie.h"
+
+#include <stdexcept>
+
+namespace
+{
+Trie buildUnionTrie(const std::vector<std::vector<std::string_view>>& wordLists)
+{
+    if (wordLists.size() > MultiTrie::maxLists)
+    {
+        throw std::invalid_argument("A MultiTrie holds at most 64 word lists");
+    }
+
+    std::vector<std::string_view> allWords;
+    for (const auto& wordList : wordLists)
+    {
+        allWords.insert(allWords.end(), wordList.begin(), wordList.end());
+    }
+    return Trie{allWords};
+}
+} // namespace
+
+MultiTrie::MultiTrie(const std::vector<std::vector<std::string_view>>& wordLists)
+    : m_trie(buildUnionTrie(wordLists), TrieLayout::depthFirst), m_listCount(wordLists.size())
+{
+    m_wordMasks.assign(m_trie.nodeCount(), 0);
+    for (size_t list{0}; list < wordLists.size(); list++)
+    {
+        for (const auto word : wordLists[list])
+        {
+            uint32_t node{PackedTrie::rootIndex};
+            for (const char letter : word)
+            {
+                node = m_trie.findChild(node, letter);
+            }
+            m_wordMasks[node] |= uint64_t{1} << list;
+        }
+    }
+
+    // Children are always laid out after their parent, so a backward pass sees every subtree
+    // before its root
+    m_subtreeMasks = m_wordMasks;
+    const auto& nodes = m_trie.nodes();
+    for (size_t node{nodes.size()}; node-- > 0;)
+    {
+        const uint32_t end{nodes[node].firstChild + nodes[node].childCount};
+        for (uint32_t child{nodes[node].firstChild}; child < end; child++)
+        {
+            m_subtreeMasks[node] |= m_subtreeMasks[child];
+        }
+    }
+}
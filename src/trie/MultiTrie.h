@@ -0,0 +1,57 @@
+#ifndef MULTITRIE_H
+#define MULTITRIE_H
+
+#include "PackedTrie.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// Shared dictionary of several word lists (e.g. standard, kids-safe, tournament, regional)
+// All lists share one PackedTrie of the union of their words. Every node carries a bitmask of
+// the lists in which it is a word, and a bitmask of the lists which have a word in its subtree,
+// so that a traversal for some of the lists can skip the subtrees which only matter to others.
+class MultiTrie
+{
+public:
+    static constexpr size_t maxLists{64};
+    static constexpr uint64_t allLists{~uint64_t{0}};
+
+private:
+    PackedTrie m_trie;
+    size_t m_listCount{0};
+    std::vector<uint64_t> m_wordMasks{};    // by packed node
+    std::vector<uint64_t> m_subtreeMasks{}; // by packed node
+
+public:
+    MultiTrie() = delete;
+
+    // Constructor from the word lists; list i gets bit i in the masks
+    // Throws std::invalid_argument if there are more than maxLists lists
+    explicit MultiTrie(const std::vector<std::vector<std::string_view>>& wordLists);
+
+    size_t listCount() const
+    {
+        return m_listCount;
+    }
+
+    const PackedTrie& trie() const
+    {
+        return m_trie;
+    }
+
+    // Function to get the lists in which node is a word
+    uint64_t wordMask(uint32_t node) const
+    {
+        return m_wordMasks[node];
+    }
+
+    // Function to get the lists which have a word at node or below it
+    uint64_t subtreeMask(uint32_t node) const
+    {
+        return m_subtreeMasks[node];
+    }
+};
+
+#endif // MULTITRIE_H
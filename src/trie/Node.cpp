@@ -1,75 +1,83 @@
 #include "Node.h"
 
+// "Empty-root" constructor allocating from the resource of allocator
+Node::Node(const allocator_type& allocator) : m_key(allocator), m_children(allocator)
+{
+}
+
 // Constructor from another (parent) Node + letter
-Node::Node(const Node& parent, const char letter) : m_key(parent.getKey() + letter)
+Node::Node(const Node& parent, const char letter)
+    : m_key(parent.m_key, parent.get_allocator()), m_children(parent.get_allocator())
 {
+    m_key.push_back(letter);
 }
 
 // Copy constructor
-Node::Node(const Node& other) : m_key(other.m_key), m_validWord(other.m_validWord)
+Node::Node(const Node& other) : Node(other, allocator_type{})
+{
+}
+
+// Copy constructor allocating from the resource of allocator
+Node::Node(const Node& other, const allocator_type& allocator)
+    : m_key(other.m_key, allocator),
+      m_validWord(other.m_validWord),
+      m_id(other.m_id),
+      m_children(allocator)
 {
     // Deep copy children
-    for (const auto* child : other.m_children)
-    {
-        if (child)
-        {
-            m_children.push_back(new Node(*child));
-        }
-    }
+    copyChildren(other);
 }
 
 // Move constructor
 Node::Node(Node&& other) noexcept
     : m_key(std::move(other.m_key)),
       m_validWord(other.m_validWord),
+      m_id(other.m_id),
       m_children(std::move(other.m_children))
 {
     other.m_children.clear(); // Prevent double-deletion
 }
 
+// Move constructor allocating from the resource of allocator
+Node::Node(Node&& other, const allocator_type& allocator)
+    : m_key(std::move(other.m_key), allocator),
+      m_validWord(other.m_validWord),
+      m_id(other.m_id),
+      m_children(allocator)
+{
+    takeChildren(std::move(other));
+}
+
 // Copy assignment operator
 Node& Node::operator=(const Node& other)
 {
     if (this != &other)
     {
         // Clean up existing resources
-        for (auto* child : m_children)
-        {
-            delete child;
-        }
+        deleteChildren();
 
         m_key = other.m_key;
         m_validWord = other.m_validWord;
-        m_children.clear();
+        m_id = other.m_id;
 
         // Deep copy children
-        for (const auto* child : other.m_children)
-        {
-            if (child)
-            {
-                m_children.push_back(new Node(*child));
-            }
-        }
+        copyChildren(other);
     }
     return *this;
 }
 
 // Move assignment operator
-Node& Node::operator=(Node&& other) noexcept
+Node& Node::operator=(Node&& other)
 {
     if (this != &other)
     {
         // Clean up existing resources
-        for (auto* child : m_children)
-        {
-            delete child;
-        }
+        deleteChildren();
 
         m_key = std::move(other.m_key);
         m_validWord = other.m_validWord;
-        m_children = std::move(other.m_children);
-
-        other.m_children.clear(); // Prevent double-deletion
+        m_id = other.m_id;
+        takeChildren(std::move(other));
     }
     return *this;
 }
@@ -77,15 +85,60 @@ Node& Node::operator=(Node&& other) noexcept
 // Destructor to clean up resources (children)
 Node::~Node()
 {
+    deleteChildren();
+}
+
+void Node::copyChildren(const Node& other)
+{
+    for (const auto* child : other.m_children)
+    {
+        if (child)
+        {
+            addChildNode(*child);
+        }
+    }
+}
+
+void Node::takeChildren(Node&& other)
+{
+    if (get_allocator() == other.get_allocator())
+    {
+        m_children = std::move(other.m_children);
+        other.m_children.clear(); // Prevent double-deletion
+        return;
+    }
+
+    // The children of other live in another resource: move them into ours, other deletes theirs
+    for (auto* child : other.m_children)
+    {
+        if (child)
+        {
+            addChildNode(std::move(*child));
+        }
+    }
+}
+
+void Node::deleteChildren()
+{
+    auto allocator = get_allocator();
     for (Node* child : m_children)
     {
-        delete child;
+        if (child)
+        {
+            allocator.delete_object(child);
+        }
     }
+    m_children.clear();
+}
+
+Node::allocator_type Node::get_allocator() const
+{
+    return m_key.get_allocator();
 }
 
 std::string Node::getKey() const
 {
-    return m_key;
+    return std::string{std::string_view{m_key}};
 }
 
 void Node::setValidWord()
@@ -103,6 +156,43 @@ Node* Node::getChildAtIndex(size_t index) const
     return m_children[index]; // use operator[] (instead of .at()) for better performance
 }
 
+size_t Node::getNumChildren() const
+{
+    return m_children.size();
+}
+
+char Node::getLetter() const
+{
+    return m_key.back();
+}
+
+size_t Node::getDepth() const
+{
+    return m_key.size();
+}
+
+size_t Node::getId() const
+{
+    return m_id;
+}
+
+void Node::setId(size_t id)
+{
+    m_id = id;
+}
+
+const Node* Node::findChild(char letter) const
+{
+    for (const Node* child : m_children)
+    {
+        if (child && child->m_key.back() == letter)
+        {
+            return child;
+        }
+    }
+    return nullptr;
+}
+
 int Node::getIndexOfChildWithKey(const std::string_view key) const
 {
     for (size_t i{0}; i < m_children.size(); i++)
@@ -117,15 +207,15 @@ int Node::getIndexOfChildWithKey(const std::string_view key) const
 
 Node* Node::addChildNode(Node&& childNode)
 {
-    // Create a new node on the heap, moving resources
-    Node* newNode = new Node(std::move(childNode));
+    // Create a new node in our memory resource, moving resources (if they live in it too)
+    Node* newNode = get_allocator().new_object<Node>(std::move(childNode));
     m_children.push_back(newNode);
     return newNode;
 }
 
 Node* Node::addChildNode(const Node& childNode)
 {
-    Node* newNode = new Node(childNode);
+    Node* newNode = get_allocator().new_object<Node>(childNode);
     m_children.push_back(newNode);
     return newNode;
 }
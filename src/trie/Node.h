@@ -1,6 +1,7 @@
 #ifndef NODE_H
 #define NODE_H
 
+#include <memory_resource>
 #include <string>
 #include <string_view>
 #include <vector>
@@ -9,39 +10,80 @@
 //  1) key: a sequence of characters
 //  2) validWord: a bool indicating whether it's a valid word
 //  3) children: a vector of pointers to children nodes
+//  4) id: a number unique within the trie (the root is 0), used to index per-node tables
+// A Node is allocator-aware: its key, its children and the children's nodes are allocated from
+// the memory resource of its allocator (the default resource unless one is given), like the
+// std::pmr containers
 class Node
 {
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
 private:
-    std::string m_key{};
+    std::pmr::string m_key{};
     bool m_validWord{false};
-    std::vector<Node*> m_children{};
+    size_t m_id{0};
+    std::pmr::vector<Node*> m_children{};
+
+    // Functions to copy or take over the children of other, and to delete ours
+    void copyChildren(const Node& other);
+    void takeChildren(Node&& other);
+    void deleteChildren();
 
 public:
     // Default "empty-root" constructor
     Node() = default;
 
-    // Constructor from another (parent) Node + letter
+    // "Empty-root" constructor allocating from the resource of allocator
+    explicit Node(const allocator_type& allocator);
+
+    // Constructor from another (parent) Node + letter, allocating like the parent
     Node(const Node& parent, const char letter);
 
-    // Copy constructor
+    // Copy constructor (allocating from the default resource, like the std::pmr containers)
     Node(const Node& other);
 
+    // Copy constructor allocating from the resource of allocator
+    Node(const Node& other, const allocator_type& allocator);
+
     // Move constructor
     Node(Node&& other) noexcept;
 
-    // Copy assignment operator
+    // Move constructor allocating from the resource of allocator
+    // The children are taken over if other allocates from the same resource, copied otherwise
+    Node(Node&& other, const allocator_type& allocator);
+
+    // Copy assignment operator (the node keeps its allocator)
     Node& operator=(const Node& other);
 
-    // Move assignment operator
-    Node& operator=(Node&& other) noexcept;
+    // Move assignment operator (the node keeps its allocator)
+    Node& operator=(Node&& other);
 
     // Destructor to clean up resources (children)
     ~Node();
 
+    allocator_type get_allocator() const;
+
     std::string getKey() const;
     void setValidWord();
     bool isValidWord() const;
     Node* getChildAtIndex(size_t index) const;
+    size_t getNumChildren() const;
+
+    // Function to get the letter leading to this node (last character of the key)
+    // Must not be called on the root node
+    char getLetter() const;
+
+    // Function to get the number of letters of the key (the depth of the node in the trie)
+    size_t getDepth() const;
+
+    size_t getId() const;
+    void setId(size_t id);
+
+    // Function to search children for the one reached by letter
+    // Unlike getIndexOfChildWithKey, this doesn't need the whole key
+    // If not found, returns nullptr
+    const Node* findChild(char letter) const;
 
     // Function to search for key in children
     // If found, returns child index
@@ -0,0 +1,227 @@
+#include "PackedTrie.h"
+
+#include <algorithm>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+// Assigns packed indices to the nodes of a Trie, one sibling group (the children of a node) at a
+// time, so that siblings are always contiguous
+class LayoutBuilder
+{
+private:
+    const std::vector<uint64_t>* m_nodeHits;
+    std::vector<uint32_t> m_packedIndex; // by Trie node id
+    uint32_t m_nextIndex{0};
+
+    uint64_t hits(const Node* node) const
+    {
+        return m_nodeHits ? (*m_nodeHits)[node->getId()] : 0;
+    }
+
+public:
+    LayoutBuilder(size_t nNodes, const std::vector<uint64_t>* nodeHits)
+        : m_nodeHits(nodeHits), m_packedIndex(nNodes, PackedTrie::noNode)
+    {
+    }
+
+    LayoutBuilder(const LayoutBuilder&) = delete;
+    LayoutBuilder& operator=(const LayoutBuilder&) = delete;
+
+    // Children of node, by decreasing hits when a profile is given (stable otherwise)
+    std::vector<const Node*> orderedChildren(const Node* node) const
+    {
+        std::vector<const Node*> children;
+        for (size_t i{0}; i < node->getNumChildren(); i++)
+        {
+            children.push_back(node->getChildAtIndex(i));
+        }
+        if (m_nodeHits)
+        {
+            std::stable_sort(children.begin(), children.end(),
+                             [this](const Node* a, const Node* b) { return hits(a) > hits(b); });
+        }
+        return children;
+    }
+
+    void placeNode(const Node* node)
+    {
+        m_packedIndex[node->getId()] = m_nextIndex++;
+    }
+
+    void placeChildren(const Node* node)
+    {
+        for (const Node* child : orderedChildren(node))
+        {
+            placeNode(child);
+        }
+    }
+
+    void layoutDepthFirst(const Node* node)
+    {
+        placeChildren(node);
+        for (const Node* child : orderedChildren(node))
+        {
+            layoutDepthFirst(child);
+        }
+    }
+
+    void layoutBreadthFirst(const Node* root)
+    {
+        std::queue<const Node*> queue;
+        queue.push(root);
+        while (!queue.empty())
+        {
+            const Node* node = queue.front();
+            queue.pop();
+            placeChildren(node);
+            for (const Node* child : orderedChildren(node))
+            {
+                queue.push(child);
+            }
+        }
+    }
+
+    // Places the sibling groups of the height levels below node: the top half of the levels first,
+    // then each subtree hanging below it, recursively
+    void layoutVanEmdeBoas(const Node* node, size_t height)
+    {
+        if (height == 0 || node->getNumChildren() == 0)
+        {
+            return;
+        }
+        if (height == 1)
+        {
+            placeChildren(node);
+            return;
+        }
+
+        const size_t topHeight{height / 2};
+        layoutVanEmdeBoas(node, topHeight);
+
+        std::vector<const Node*> bottomRoots;
+        collectAtDistance(node, topHeight, bottomRoots);
+        for (const Node* bottomRoot : bottomRoots)
+        {
+            layoutVanEmdeBoas(bottomRoot, height - topHeight);
+        }
+    }
+
+    void collectAtDistance(const Node* node, size_t distance, std::vector<const Node*>& found) const
+    {
+        if (distance == 0)
+        {
+            found.push_back(node);
+            return;
+        }
+        for (const Node* child : orderedChildren(node))
+        {
+            collectAtDistance(child, distance - 1, found);
+        }
+    }
+
+    // Places sibling groups by decreasing hits of their parent, always choosing the hottest group
+    // whose parent is already placed
+    void layoutHotFirst(const Node* root)
+    {
+        using Entry = std::pair<uint64_t, const Node*>;
+        auto colder = [](const Entry& a, const Entry& b) { return a.first < b.first; };
+        std::priority_queue<Entry, std::vector<Entry>, decltype(colder)> queue(colder);
+
+        queue.emplace(hits(root), root);
+        while (!queue.empty())
+        {
+            const Node* node = queue.top().second;
+            queue.pop();
+            placeChildren(node);
+            for (const Node* child : orderedChildren(node))
+            {
+                if (child->getNumChildren() > 0)
+                {
+                    queue.emplace(hits(child), child);
+                }
+            }
+        }
+    }
+
+    uint32_t packedIndex(const Node* node) const
+    {
+        return m_packedIndex[node->getId()];
+    }
+};
+
+size_t trieHeight(const Node* node)
+{
+    size_t height{0};
+    for (size_t i{0}; i < node->getNumChildren(); i++)
+    {
+        height = std::max(height, 1 + trieHeight(node->getChildAtIndex(i)));
+    }
+    return height;
+}
+} // namespace
+
+PackedTrie::PackedTrie(const Trie& wordsTrie, TrieLayout layout,
+                       const std::vector<uint64_t>* nodeHits)
+{
+    if (layout == TrieLayout::hotFirst && !nodeHits)
+    {
+        throw std::invalid_argument("The hot-first layout requires node hit counts");
+    }
+    if (nodeHits && nodeHits->size() != wordsTrie.getNodeCount())
+    {
+        throw std::invalid_argument("Node hit counts do not match the trie");
+    }
+
+    const Node* root = &wordsTrie.getRoot();
+    LayoutBuilder builder(wordsTrie.getNodeCount(), nodeHits);
+    builder.placeNode(root);
+
+    switch (layout)
+    {
+    case TrieLayout::depthFirst:
+        builder.layoutDepthFirst(root);
+        break;
+    case TrieLayout::breadthFirst:
+        builder.layoutBreadthFirst(root);
+        break;
+    case TrieLayout::vanEmdeBoas:
+        builder.layoutVanEmdeBoas(root, trieHeight(root));
+        break;
+    case TrieLayout::hotFirst:
+        builder.layoutHotFirst(root);
+        break;
+    }
+
+    // Fill in the nodes at their packed indices
+    m_nodes.resize(wordsTrie.getNodeCount());
+    m_trieNodeIds.resize(wordsTrie.getNodeCount());
+
+    std::vector<const Node*> stack{root};
+    while (!stack.empty())
+    {
+        const Node* node = stack.back();
+        stack.pop_back();
+
+        if (node->getNumChildren() > 255)
+        {
+            throw std::invalid_argument("Packed trie nodes have at most 255 children");
+        }
+
+        const uint32_t index{builder.packedIndex(node)};
+        PackedNode& packedNode = m_nodes[index];
+        packedNode.letter = (node == root) ? '\0' : node->getLetter();
+        packedNode.isWord = node->isValidWord() ? 1 : 0;
+        packedNode.childCount = static_cast<uint8_t>(node->getNumChildren());
+        m_trieNodeIds[index] = static_cast<uint32_t>(node->getId());
+
+        const auto children = builder.orderedChildren(node);
+        packedNode.firstChild = children.empty() ? 0 : builder.packedIndex(children.front());
+        for (const Node* child : children)
+        {
+            stack.push_back(child);
+        }
+    }
+}
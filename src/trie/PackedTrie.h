@@ -0,0 +1,97 @@
+#ifndef PACKEDTRIE_H
+#define PACKEDTRIE_H
+
+#include "Trie.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+// Order in which the nodes of a PackedTrie are laid out in memory
+// Siblings are always contiguous; the layout decides where each group of siblings goes.
+enum class TrieLayout
+{
+    depthFirst,   // each sibling group is followed by the groups below it, like Trie::addWord order
+    breadthFirst, // level by level from the root
+    vanEmdeBoas,  // recursive split of the tree by height, so subtrees share cache lines at all scales
+    hotFirst      // sibling groups by decreasing hit count (needs a profile)
+};
+
+// Compact, array-based copy of a Trie whose node layout can be chosen
+// Every node is 8 bytes, so 8 nodes share a 64-byte cache line. With a profile of hit counts (see
+// profileNodeHits), siblings are also ordered by decreasing hits, so that the linear search for a
+// child finds the hot ones first.
+class PackedTrie
+{
+public:
+    struct PackedNode
+    {
+        uint32_t firstChild{0};
+        uint8_t childCount{0};
+        char letter{'\0'};
+        uint8_t isWord{0};
+        uint8_t padding{0};
+    };
+
+    static constexpr uint32_t rootIndex{0};
+    static constexpr uint32_t noNode{std::numeric_limits<uint32_t>::max()};
+
+private:
+    std::vector<PackedNode> m_nodes{};
+    std::vector<uint32_t> m_trieNodeIds{}; // Trie node id of every packed node
+
+public:
+    PackedTrie() = delete;
+
+    // Constructor from a Trie
+    // nodeHits, indexed by Trie node id, is required for TrieLayout::hotFirst; when given, siblings
+    // are ordered by decreasing hits in every layout
+    explicit PackedTrie(const Trie& wordsTrie, TrieLayout layout = TrieLayout::breadthFirst,
+                        const std::vector<uint64_t>* nodeHits = nullptr);
+
+    // Function to get the child of node reached by letter (noNode if none)
+    uint32_t findChild(uint32_t node, char letter) const
+    {
+        return findChild(m_nodes, node, letter);
+    }
+
+    // Overload searching nodes stored elsewhere (e.g. a copy of nodes() in shared memory)
+    static uint32_t findChild(std::span<const PackedNode> nodes, uint32_t node, char letter)
+    {
+        const PackedNode& packedNode = nodes[node];
+        const uint32_t end{packedNode.firstChild + packedNode.childCount};
+        for (uint32_t child{packedNode.firstChild}; child < end; child++)
+        {
+            if (nodes[child].letter == letter)
+            {
+                return child;
+            }
+        }
+        return noNode;
+    }
+
+    bool isWord(uint32_t node) const
+    {
+        return m_nodes[node].isWord != 0;
+    }
+
+    size_t nodeCount() const
+    {
+        return m_nodes.size();
+    }
+
+    // Function to get the id in the source Trie of a packed node
+    uint32_t trieNodeId(uint32_t node) const
+    {
+        return m_trieNodeIds[node];
+    }
+
+    const std::vector<PackedNode>& nodes() const
+    {
+        return m_nodes;
+    }
+};
+
+#endif // PACKEDTRIE_H
@@ -0,0 +1,183 @@
+#include "PerfectHashDictionary.h"
+
+#include <algorithm>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+namespace
+{
+constexpr size_t bucketSize{4};        // fingerprints per bucket, on average
+constexpr uint32_t maxPilot{1u << 24}; // pilots tried for a bucket before reseeding
+constexpr uint64_t maxSeeds{16};
+
+// Finalizer of MurmurHash3: a bijection mixing every bit into every other
+uint64_t mix(uint64_t x)
+{
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+// Function to get the fingerprint of a prefix extended by letter
+uint64_t extend(uint64_t fingerprint, char letter)
+{
+    const auto code = static_cast<uint64_t>(static_cast<unsigned char>(letter)) + 1;
+    return mix(fingerprint ^ (code * 0x9e3779b97f4a7c15ULL));
+}
+
+// Function to map the high 32 bits of hash to [0, n), without a division
+uint32_t reduce(uint64_t hash, size_t n)
+{
+    return static_cast<uint32_t>(((hash >> 32) * n) >> 32);
+}
+} // namespace
+
+PerfectHashDictionary::PerfectHashDictionary(const Trie& wordsTrie)
+{
+    for (; m_seed < maxSeeds; m_seed++)
+    {
+        // Fingerprints of all prefixes, walking the trie
+        std::vector<uint64_t> fingerprints;
+        std::vector<uint8_t> isWord;
+        fingerprints.reserve(wordsTrie.getNodeCount());
+        isWord.reserve(wordsTrie.getNodeCount());
+        std::vector<std::pair<const Node*, uint64_t>> stack{{&wordsTrie.getRoot(), mix(m_seed)}};
+        while (!stack.empty())
+        {
+            const auto [node, fingerprint] = stack.back();
+            stack.pop_back();
+            fingerprints.push_back(fingerprint);
+            isWord.push_back(node->isValidWord() ? 1 : 0);
+            for (size_t i{0}; i < node->getNumChildren(); i++)
+            {
+                const Node* child = node->getChildAtIndex(i);
+                stack.emplace_back(child, extend(fingerprint, child->getLetter()));
+            }
+        }
+
+        // The lowest bit holds the word flag, so prefixes must differ in the others
+        std::vector<uint64_t> keys(fingerprints.size());
+        std::transform(fingerprints.begin(), fingerprints.end(), keys.begin(),
+                       [](uint64_t fingerprint) { return fingerprint >> 1; });
+        std::sort(keys.begin(), keys.end());
+        if (std::adjacent_find(keys.begin(), keys.end()) != keys.end())
+        {
+            continue;
+        }
+
+        if (place(fingerprints, isWord))
+        {
+            return;
+        }
+    }
+    throw std::runtime_error("Cannot build a perfect hash of the prefixes");
+}
+
+bool PerfectHashDictionary::place(const std::vector<uint64_t>& fingerprints,
+                                  const std::vector<uint8_t>& isWord)
+{
+    const size_t n{fingerprints.size()};
+    const size_t nBuckets{(n + bucketSize - 1) / bucketSize};
+    m_pilots.assign(nBuckets, 0);
+    m_slots.assign(n, 0);
+
+    // Fingerprints grouped by bucket (counting sort)
+    std::vector<uint32_t> bucketStart(nBuckets + 1, 0);
+    for (const uint64_t fingerprint : fingerprints)
+    {
+        bucketStart[bucketOf(fingerprint) + 1]++;
+    }
+    std::partial_sum(bucketStart.begin(), bucketStart.end(), bucketStart.begin());
+    std::vector<uint32_t> members(n);
+    std::vector<uint32_t> cursor(bucketStart.begin(), bucketStart.end() - 1);
+    for (uint32_t key{0}; key < n; key++)
+    {
+        members[cursor[bucketOf(fingerprints[key])]++] = key;
+    }
+
+    // Largest buckets first, while most slots are free
+    std::vector<uint32_t> order(nBuckets);
+    std::iota(order.begin(), order.end(), 0);
+    auto bucketSizeOf = [&bucketStart](uint32_t bucket)
+    { return bucketStart[bucket + 1] - bucketStart[bucket]; };
+    std::stable_sort(order.begin(), order.end(), [&bucketSizeOf](uint32_t left, uint32_t right)
+                     { return bucketSizeOf(left) > bucketSizeOf(right); });
+
+    std::vector<uint8_t> taken(n, 0);
+    std::vector<uint32_t> slots;
+    for (const uint32_t bucket : order)
+    {
+        if (bucketSizeOf(bucket) == 0)
+        {
+            break;
+        }
+
+        bool placed{false};
+        for (uint32_t pilot{0}; pilot < maxPilot && !placed; pilot++)
+        {
+            slots.clear();
+            placed = true;
+            for (uint32_t i{bucketStart[bucket]}; i < bucketStart[bucket + 1]; i++)
+            {
+                const uint32_t slot{slotOf(fingerprints[members[i]], pilot)};
+                if (taken[slot] != 0 || std::find(slots.begin(), slots.end(), slot) != slots.end())
+                {
+                    placed = false;
+                    break;
+                }
+                slots.push_back(slot);
+            }
+            if (!placed)
+            {
+                continue;
+            }
+
+            m_pilots[bucket] = pilot;
+            for (size_t i{0}; i < slots.size(); i++)
+            {
+                const uint32_t key{members[bucketStart[bucket] + i]};
+                taken[slots[i]] = 1;
+                m_slots[slots[i]] = (fingerprints[key] & ~uint64_t{1}) | isWord[key];
+            }
+        }
+        if (!placed)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t PerfectHashDictionary::bucketOf(uint64_t fingerprint) const
+{
+    return reduce(fingerprint, m_pilots.size());
+}
+
+uint32_t PerfectHashDictionary::slotOf(uint64_t fingerprint, uint32_t pilot) const
+{
+    return reduce(mix(fingerprint ^ (pilot * 0xc2b2ae3d27d4eb4fULL)), m_slots.size());
+}
+
+PerfectHashDictionary::State PerfectHashDictionary::lookup(uint64_t fingerprint) const
+{
+    const uint64_t slot{m_slots[slotOf(fingerprint, m_pilots[bucketOf(fingerprint)])]};
+    if (((slot ^ fingerprint) >> 1) != 0)
+    {
+        return {};
+    }
+    return {fingerprint, true, (slot & 1) != 0};
+}
+
+PerfectHashDictionary::State PerfectHashDictionary::start() const
+{
+    return lookup(mix(m_seed));
+}
+
+PerfectHashDictionary::State PerfectHashDictionary::step(const State& state, char letter) const
+{
+    return state.prefix ? lookup(extend(state.fingerprint, letter)) : State{};
+}
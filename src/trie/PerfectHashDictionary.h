@@ -0,0 +1,84 @@
+#ifndef PERFECTHASHDICTIONARY_H
+#define PERFECTHASHDICTIONARY_H
+
+#include "Trie.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Dictionary storing every prefix of every word (the nodes of a Trie) in a minimal perfect hash
+// A prefix is identified by a 64-bit fingerprint which is extended letter by letter, so a lookup
+// never hashes the whole prefix again. The fingerprints are placed with hash-and-displace (CHD):
+// they are split into buckets of about 4, and every bucket, largest first, gets the first "pilot"
+// which sends all of its fingerprints to free slots of a table of exactly one slot per prefix. A
+// lookup reads the pilot of the bucket and the slot, which holds the fingerprint of its prefix (to
+// reject strings which aren't prefixes) with the word flag in the lowest bit.
+// Prefixes can't collide (the build reseeds until all fingerprints differ); another string is only
+// taken for a prefix if its 63 fingerprint bits match, with a chance of about 1e-19 per lookup.
+class PerfectHashDictionary
+{
+public:
+    // A prefix: its fingerprint and whether it is a prefix of some word (and a word)
+    struct State
+    {
+        uint64_t fingerprint{0};
+        bool prefix{false};
+        bool word{false};
+    };
+
+private:
+    uint64_t m_seed{0};
+    std::vector<uint32_t> m_pilots{}; // by bucket
+    std::vector<uint64_t> m_slots{};  // fingerprint of the prefix in every slot, low bit: is a word
+
+    // Function to place the fingerprints; returns false if a bucket can't be placed
+    bool place(const std::vector<uint64_t>& fingerprints, const std::vector<uint8_t>& isWord);
+
+    uint32_t bucketOf(uint64_t fingerprint) const;
+    uint32_t slotOf(uint64_t fingerprint, uint32_t pilot) const;
+
+    // Function to get the state of the prefix with a fingerprint (dead if it isn't stored)
+    State lookup(uint64_t fingerprint) const;
+
+public:
+    PerfectHashDictionary() = delete;
+
+    // Constructor from a Trie; its nodes are the prefixes
+    explicit PerfectHashDictionary(const Trie& wordsTrie);
+
+    // Function to get the state of the empty prefix
+    State start() const;
+
+    // Function to get the state of the prefix of state extended by letter
+    // Once no word starts with the prefix, the state is dead (not a prefix) and stays dead
+    State step(const State& state, char letter) const;
+
+    bool isWord(const State& state) const
+    {
+        return state.word;
+    }
+
+    bool isPrefix(const State& state) const
+    {
+        return state.prefix;
+    }
+
+    size_t prefixCount() const
+    {
+        return m_slots.size();
+    }
+
+    size_t bucketCount() const
+    {
+        return m_pilots.size();
+    }
+
+    // Function to get the bytes of the pilots and the slots
+    size_t memoryBytes() const
+    {
+        return m_pilots.size() * sizeof(uint32_t) + m_slots.size() * sizeof(uint64_t);
+    }
+};
+
+#endif // PERFECTHASHDICTIONARY_H
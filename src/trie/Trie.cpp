@@ -1,8 +1,11 @@
 #include "Trie.h"
 
+#include "boggle_counters.h"
+
 #include <string>
 
-Trie::Trie(const std::vector<std::string_view>& words)
+Trie::Trie(const std::vector<std::string_view>& words, std::pmr::memory_resource* resource)
+    : m_root(Node::allocator_type{resource})
 {
     for (const auto& word : words)
     {
@@ -13,11 +16,12 @@ Trie::Trie(const std::vector<std::string_view>& words)
 void Trie::addWord(std::string_view word)
 {
     Node* current_node_ptr = &m_root;
-    std::string current_prefix;
 
-    for (const auto& letter : word)
+    for (size_t i = 0; i < word.length(); ++i)
     {
-        current_prefix += letter;
+        // The prefix is a view of the word, so that only new nodes allocate
+        const char letter{word[i]};
+        const std::string_view current_prefix{word.substr(0, i + 1)};
 
         // Check if this prefix exists in the children
         int childIndex = current_node_ptr->getIndexOfChildWithKey(current_prefix);
@@ -27,6 +31,7 @@ void Trie::addWord(std::string_view word)
         {
             // Create new node with just the new letter (not the whole prefix)
             Node newNode(*current_node_ptr, letter);
+            newNode.setId(m_nodeCount++);
             current_node_ptr = current_node_ptr->addChildNode(std::move(newNode));
         }
         else
@@ -57,6 +62,7 @@ inTrie Trie::contains(const std::string_view& word) const
 
         // Use the existing method to find the child with this prefix
         int childIndex = current_node_ptr->getIndexOfChildWithKey(current_prefix);
+        BOGGLE_COUNT(trieSteps, 1);
 
         if (childIndex < 0)
         {
@@ -70,3 +76,43 @@ inTrie Trie::contains(const std::string_view& word) const
 
     return current_node_ptr->isValidWord() ? inTrie::isWord : inTrie::existsButNotWord;
 }
+
+const Node& Trie::getRoot() const
+{
+    return m_root;
+}
+
+size_t Trie::getNodeCount() const
+{
+    return m_nodeCount;
+}
+
+std::pmr::memory_resource* Trie::getMemoryResource() const
+{
+    return m_root.get_allocator().resource();
+}
+
+std::vector<std::string> Trie::getWords() const
+{
+    std::vector<std::string> words{};
+
+    // Explicit stack of nodes still to visit; children are pushed in reverse to keep their order
+    std::vector<const Node*> stack{&m_root};
+    while (!stack.empty())
+    {
+        const Node* node = stack.back();
+        stack.pop_back();
+
+        if (node->isValidWord())
+        {
+            words.push_back(node->getKey());
+        }
+
+        for (size_t i{node->getNumChildren()}; i > 0; i--)
+        {
+            stack.push_back(node->getChildAtIndex(i - 1));
+        }
+    }
+
+    return words;
+}
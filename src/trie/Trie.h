@@ -4,6 +4,8 @@
 #include "Node.h"
 
 #include <array>
+#include <memory_resource>
+#include <string>
 #include <string_view>
 #include <vector>
 
@@ -24,6 +26,7 @@ class Trie
 {
 private:
     Node m_root{};
+    size_t m_nodeCount{1}; // including the root
 
 public:
     // Constructor from array of strings
@@ -41,11 +44,16 @@ public:
     //  iv)      Is the word complete?
     //              - Yes:  set node as valid word
     //              - No:   nothing (continue to next letter)
-    explicit Trie(const std::vector<std::string_view>& words);
+    // The nodes are allocated from resource, e.g. a std::pmr::monotonic_buffer_resource so that
+    // the whole trie is released in one go; the trie must not outlive it
+    explicit Trie(const std::vector<std::string_view>& words,
+                  std::pmr::memory_resource* resource = std::pmr::get_default_resource());
 
     // New array constructor
     template <size_t N>
-    explicit Trie(const std::array<std::string_view, N>& words)
+    explicit Trie(const std::array<std::string_view, N>& words,
+                  std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : m_root(Node::allocator_type{resource})
     {
         for (const auto& word : words)
         {
@@ -66,6 +74,18 @@ public:
     //          - Yes:  Make that child the current node
     // 4. Return whether the current node contains a valid word (isWord) or not (existsButNotWord)
     inTrie contains(const std::string_view& word) const;
+
+    // Function to get the root node, for walking the trie node by node
+    const Node& getRoot() const;
+
+    // Function to get all words of the trie, in depth-first order
+    std::vector<std::string> getWords() const;
+
+    // Function to get the number of nodes (node ids are 0 to getNodeCount() - 1)
+    size_t getNodeCount() const;
+
+    // Function to get the memory resource the nodes are allocated from
+    std::pmr::memory_resource* getMemoryResource() const;
 };
 
 #endif // TRIE_H
@@ -0,0 +1,59 @@
+#include "TrieTable.h"
+
+#include <utility>
+
+TrieTable::TrieTable(const Trie& wordsTrie) : m_nColumns(27)
+{
+    m_columnOf.fill(static_cast<uint32_t>(m_nColumns - 1));
+    for (char letter{'A'}; letter <= 'Z'; letter++)
+    {
+        m_columnOf[static_cast<unsigned char>(letter)] = static_cast<uint32_t>(letter - 'A');
+    }
+    buildFrom(wordsTrie);
+}
+
+TrieTable::TrieTable(const Trie& wordsTrie, const Alphabet& alphabet)
+    : m_nColumns(alphabet.codeCount() + 1)
+{
+    m_columnOf.fill(static_cast<uint32_t>(m_nColumns - 1));
+    for (size_t code{0}; code < alphabet.codeCount(); code++)
+    {
+        m_columnOf[code] = static_cast<uint32_t>(code);
+    }
+    buildFrom(wordsTrie);
+}
+
+void TrieTable::buildFrom(const Trie& wordsTrie)
+{
+    // Dead state, then the root
+    m_transitions.assign(2 * m_nColumns, deadState);
+    m_isWord.assign(2, 0);
+    m_isWord[rootState] = wordsTrie.getRoot().isValidWord() ? 1 : 0;
+
+    // Breadth-first walk, numbering children as they are discovered
+    std::vector<std::pair<const Node*, uint32_t>> queue{{&wordsTrie.getRoot(), rootState}};
+    for (size_t head{0}; head < queue.size(); head++)
+    {
+        const auto [node, state] = queue[head];
+
+        for (size_t i{0}; i < node->getNumChildren(); i++)
+        {
+            const Node* child = node->getChildAtIndex(i);
+
+            // Words with letters outside the alphabet can't be represented, "other" stays dead
+            const auto column{letterColumn(child->getLetter())};
+            if (column == m_nColumns - 1)
+            {
+                continue;
+            }
+
+            const auto childState{static_cast<uint32_t>(m_isWord.size())};
+
+            m_transitions.resize(m_transitions.size() + m_nColumns, deadState);
+            m_isWord.push_back(child->isValidWord() ? 1 : 0);
+            m_transitions[state * m_nColumns + column] = childState;
+
+            queue.emplace_back(child, childState);
+        }
+    }
+}
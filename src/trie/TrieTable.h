@@ -0,0 +1,89 @@
+#ifndef TRIETABLE_H
+#define TRIETABLE_H
+
+#include "Alphabet.h"
+#include "Trie.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Dense transition table built from a Trie
+// Every trie node becomes a state (a row of the table) with one column per letter of the alphabet
+// plus one column for any other character, which always leads to the dead state (words containing
+// other characters are left out). The alphabet is either 'A'-'Z' or the codes of an Alphabet, for
+// a Trie of encoded words, so rows are sized to the real alphabet.
+// State 0 is a dead state which all missing transitions lead to and which never leaves itself, so
+// walking the table needs no branches. This makes it usable from vectorized code, where many
+// independent walks advance at once.
+class TrieTable
+{
+public:
+    static constexpr uint32_t deadState{0};
+    static constexpr uint32_t rootState{1};
+
+private:
+    size_t m_nColumns{0};
+    std::array<uint32_t, 256> m_columnOf{}; // column of every char (by unsigned value)
+    std::vector<uint32_t> m_transitions{};  // row-major, m_nColumns per state
+    std::vector<uint8_t> m_isWord{};
+
+    void buildFrom(const Trie& wordsTrie);
+
+public:
+    TrieTable() = delete;
+
+    // Constructor from a Trie of 'A'-'Z' words; states are numbered in breadth-first order
+    explicit TrieTable(const Trie& wordsTrie);
+
+    // Constructor from a Trie of words encoded with alphabet (see Alphabet::encodeWords)
+    TrieTable(const Trie& wordsTrie, const Alphabet& alphabet);
+
+    // Number of columns of a row (letters and the "other" column)
+    size_t columnCount() const
+    {
+        return m_nColumns;
+    }
+
+    // Function to get the column of a letter
+    uint32_t letterColumn(char letter) const
+    {
+        return m_columnOf[static_cast<unsigned char>(letter)];
+    }
+
+    // Function to get the state reached from state by a letter column (deadState if none)
+    uint32_t stepColumn(uint32_t state, uint32_t column) const
+    {
+        return m_transitions[state * m_nColumns + column];
+    }
+
+    // Function to get the state reached from state by letter (deadState if none)
+    uint32_t step(uint32_t state, char letter) const
+    {
+        return stepColumn(state, letterColumn(letter));
+    }
+
+    bool isWord(uint32_t state) const
+    {
+        return m_isWord[state] != 0;
+    }
+
+    size_t stateCount() const
+    {
+        return m_isWord.size();
+    }
+
+    // Raw access to the table, for vectorized lookups
+    const uint32_t* transitions() const
+    {
+        return m_transitions.data();
+    }
+
+    const uint8_t* wordFlags() const
+    {
+        return m_isWord.data();
+    }
+};
+
+#endif // TRIETABLE_H
@@ -0,0 +1,69 @@
+#include "WordIndex.h"
+
+#include <algorithm>
+
+namespace
+{
+struct IdAssignment
+{
+    const PackedTrie& trie;
+    std::vector<uint32_t>& wordIds;
+    std::string& text;
+    std::vector<uint32_t>& offsets;
+    std::string currentWord{};
+
+    // Numbers the words of the subtree of node in pre-order, children by letter, which is the
+    // lexicographic order of the words (a word comes before its extensions)
+    void visit(uint32_t node)
+    {
+        const auto& packedNode = trie.nodes()[node];
+        if (packedNode.isWord != 0)
+        {
+            wordIds[node] = static_cast<uint32_t>(offsets.size() - 1);
+            text += currentWord;
+            offsets.push_back(static_cast<uint32_t>(text.size()));
+        }
+
+        std::vector<uint32_t> children(packedNode.childCount);
+        for (uint32_t i{0}; i < packedNode.childCount; i++)
+        {
+            children[i] = packedNode.firstChild + i;
+        }
+        std::sort(children.begin(), children.end(),
+                  [this](uint32_t a, uint32_t b)
+                  {
+                      return static_cast<unsigned char>(trie.nodes()[a].letter)
+                             < static_cast<unsigned char>(trie.nodes()[b].letter);
+                  });
+
+        for (const uint32_t child : children)
+        {
+            currentWord.push_back(trie.nodes()[child].letter);
+            visit(child);
+            currentWord.pop_back();
+        }
+    }
+};
+} // namespace
+
+WordIndex::WordIndex(const Trie& wordsTrie) : m_trie(wordsTrie, TrieLayout::depthFirst)
+{
+    m_wordIds.assign(m_trie.nodeCount(), noWord);
+    m_offsets.push_back(0);
+    IdAssignment assignment{m_trie, m_wordIds, m_text, m_offsets};
+    assignment.visit(PackedTrie::rootIndex);
+}
+
+uint32_t WordIndex::find(std::string_view word) const
+{
+    uint32_t node{PackedTrie::rootIndex};
+    for (const char letter : word)
+    {
+        node = m_trie.findChild(node, letter);
+        if (node == PackedTrie::noNode)
+        {
+            return noWord;
+        }
+    }
+    return m_wordIds[node];
+}
@@ -0,0 +1,60 @@
+#ifndef WORDINDEX_H
+#define WORDINDEX_H
+
+#include "PackedTrie.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Dictionary whose words are numbered in lexicographic order
+// Word ids are assigned once, by walking the trie with every node's children in letter order, so
+// that a set of found words can be kept as ids (see WordIdSet) and listed in lexicographic order by
+// scanning the ids, without comparing strings. The words are stored back to back in one buffer to
+// hand out string_views of them.
+class WordIndex
+{
+public:
+    static constexpr uint32_t noWord{std::numeric_limits<uint32_t>::max()};
+
+private:
+    PackedTrie m_trie;
+    std::vector<uint32_t> m_wordIds{}; // by packed node, noWord if the node isn't a word
+    std::string m_text{};              // all words in id order
+    std::vector<uint32_t> m_offsets{}; // start of every word in m_text, and its end
+
+public:
+    WordIndex() = delete;
+
+    explicit WordIndex(const Trie& wordsTrie);
+
+    size_t wordCount() const
+    {
+        return m_offsets.size() - 1;
+    }
+
+    const PackedTrie& trie() const
+    {
+        return m_trie;
+    }
+
+    // Function to get the id of the word ending at a packed node (noWord if none)
+    uint32_t wordId(uint32_t node) const
+    {
+        return m_wordIds[node];
+    }
+
+    // Function to get the word with an id; the view stays valid as long as the index
+    std::string_view word(uint32_t id) const
+    {
+        return std::string_view(m_text).substr(m_offsets[id], m_offsets[id + 1] - m_offsets[id]);
+    }
+
+    // Function to get the id of a word (noWord if it isn't in the dictionary)
+    uint32_t find(std::string_view word) const;
+};
+
+#endif // WORDINDEX_H
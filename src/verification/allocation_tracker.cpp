@@ -0,0 +1,181 @@
+#include "allocation_tracker.h"
+
+#if defined(BOGGLE_TRACK_ALLOCATIONS) && BOGGLE_TRACK_ALLOCATIONS
+#include <cstdlib>
+#include <new>
+#endif
+
+namespace
+{
+// Plain counters (no constructor), so that the first allocation of a thread can use them safely
+thread_local AllocationStats threadStats;
+} // namespace
+
+AllocationStats threadAllocationStats()
+{
+    return threadStats;
+}
+
+void* CountingResource::do_allocate(size_t bytes, size_t alignment)
+{
+    void* pointer = m_upstream->allocate(bytes, alignment);
+    allocations++;
+    bytesInUse += bytes;
+    return pointer;
+}
+
+void CountingResource::do_deallocate(void* pointer, size_t bytes, size_t alignment)
+{
+    m_upstream->deallocate(pointer, bytes, alignment);
+    deallocations++;
+    bytesInUse -= bytes;
+}
+
+bool CountingResource::do_is_equal(const std::pmr::memory_resource& other) const noexcept
+{
+    return this == &other;
+}
+
+#if defined(BOGGLE_TRACK_ALLOCATIONS) && BOGGLE_TRACK_ALLOCATIONS
+namespace
+{
+void* trackedAllocate(std::size_t size)
+{
+    void* memory = std::malloc(size == 0 ? 1 : size);
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+    threadStats.allocations++;
+    threadStats.bytes += size;
+    return memory;
+}
+
+void* trackedAllocateAligned(std::size_t size, std::align_val_t alignment)
+{
+    const auto align = static_cast<std::size_t>(alignment);
+    const std::size_t roundedSize{((size == 0 ? 1 : size) + align - 1) / align * align};
+#ifdef _WIN32
+    void* memory = _aligned_malloc(roundedSize, align);
+#else
+    void* memory = std::aligned_alloc(align, roundedSize);
+#endif
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+    threadStats.allocations++;
+    threadStats.bytes += size;
+    return memory;
+}
+
+void trackedFree(void* memory) noexcept
+{
+    if (memory)
+    {
+        threadStats.deallocations++;
+        std::free(memory);
+    }
+}
+
+void trackedFreeAligned(void* memory) noexcept
+{
+    if (memory)
+    {
+        threadStats.deallocations++;
+#ifdef _WIN32
+        _aligned_free(memory);
+#else
+        std::free(memory);
+#endif
+    }
+}
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    return trackedAllocate(size);
+}
+
+void* operator new[](std::size_t size)
+{
+    return trackedAllocate(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+    try
+    {
+        return trackedAllocate(size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        return nullptr;
+    }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+    return operator new(size, std::nothrow);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment)
+{
+    return trackedAllocateAligned(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment)
+{
+    return trackedAllocateAligned(size, alignment);
+}
+
+void operator delete(void* memory) noexcept
+{
+    trackedFree(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    trackedFree(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    trackedFree(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    trackedFree(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept
+{
+    trackedFree(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept
+{
+    trackedFree(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept
+{
+    trackedFreeAligned(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept
+{
+    trackedFreeAligned(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept
+{
+    trackedFreeAligned(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept
+{
+    trackedFreeAligned(memory);
+}
+#endif
@@ -0,0 +1,71 @@
+#ifndef ALLOCATION_TRACKER_H
+#define ALLOCATION_TRACKER_H
+
+#include <cstddef>
+#include <memory_resource>
+
+// Heap allocations made by the calling thread through operator new/delete
+// They are only counted when the project is configured with -DBOGGLE_TRACK_ALLOCATIONS=ON, which
+// replaces the global operator new/delete; otherwise all counts stay zero.
+struct AllocationStats
+{
+    size_t allocations{0};
+    size_t bytes{0};
+    size_t deallocations{0};
+};
+
+#if defined(BOGGLE_TRACK_ALLOCATIONS) && BOGGLE_TRACK_ALLOCATIONS
+inline constexpr bool allocationTrackingEnabled{true};
+#else
+inline constexpr bool allocationTrackingEnabled{false};
+#endif
+
+// Function to get the allocations of the calling thread since it started
+AllocationStats threadAllocationStats();
+
+// Allocations of the calling thread since the scope was created
+class AllocationScope
+{
+private:
+    AllocationStats m_start;
+
+public:
+    AllocationScope() : m_start(threadAllocationStats())
+    {
+    }
+
+    AllocationStats stats() const
+    {
+        const AllocationStats now{threadAllocationStats()};
+        return {now.allocations - m_start.allocations, now.bytes - m_start.bytes,
+                now.deallocations - m_start.deallocations};
+    }
+};
+
+// Memory resource counting what it allocates from an upstream resource (the default resource
+// unless given), e.g. to measure the memory of a Trie built on it; counts in every build
+class CountingResource : public std::pmr::memory_resource
+{
+private:
+    std::pmr::memory_resource* m_upstream;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override;
+
+public:
+    size_t allocations{0};
+    size_t deallocations{0};
+    size_t bytesInUse{0};
+
+    explicit CountingResource(
+        std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : m_upstream(upstream)
+    {
+    }
+
+    CountingResource(const CountingResource&) = delete;
+    CountingResource& operator=(const CountingResource&) = delete;
+};
+
+#endif // ALLOCATION_TRACKER_H
@@ -0,0 +1,495 @@
+#include "differential_fuzzer.h"
+
+#include "BoardGenerator.h"
+#include "Trie.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <istream>
+#include <iterator>
+#include <mutex>
+#include <ostream>
+#include <sstream>
+#include <stdexcept>
+#include <string_view>
+#include <thread>
+
+namespace
+{
+// Cells adjacent to cell (row-major index)
+std::vector<size_t> neighboursOf(const Board& board, size_t cell)
+{
+    std::vector<size_t> neighbours;
+    const size_t r{cell / board.columns};
+    const size_t c{cell % board.columns};
+    for (size_t nextR{r > 0 ? r - 1 : 0}; nextR <= std::min(r + 1, board.rows - 1); nextR++)
+    {
+        for (size_t nextC{c > 0 ? c - 1 : 0}; nextC <= std::min(c + 1, board.columns - 1);
+             nextC++)
+        {
+            if (nextR != r || nextC != c)
+            {
+                neighbours.push_back(nextR * board.columns + nextC);
+            }
+        }
+    }
+    return neighbours;
+}
+
+// Whether word[pos..] can be spelled starting at cell without reusing a visited cell
+bool spellsFrom(const Board& board, std::string_view word, size_t pos, size_t cell,
+                std::vector<bool>& visited)
+{
+    if (visited[cell] || (board.table[cell] != word[pos] && board.table[cell] != wildcardTile))
+    {
+        return false;
+    }
+    if (pos + 1 == word.size())
+    {
+        return true;
+    }
+
+    visited[cell] = true;
+    bool found{false};
+    for (const size_t next : neighboursOf(board, cell))
+    {
+        if (spellsFrom(board, word, pos + 1, next, visited))
+        {
+            found = true;
+            break;
+        }
+    }
+    visited[cell] = false;
+    return found;
+}
+
+std::vector<std::string> sortedDistinct(std::vector<std::string> words)
+{
+    std::sort(words.begin(), words.end());
+    words.erase(std::unique(words.begin(), words.end()), words.end());
+    return words;
+}
+
+Board removeRow(const Board& board, size_t row)
+{
+    Board smaller;
+    smaller.rows = board.rows - 1;
+    smaller.columns = board.columns;
+    for (size_t cell{0}; cell < board.table.size(); cell++)
+    {
+        if (cell / board.columns != row)
+        {
+            smaller.table.push_back(board.table[cell]);
+        }
+    }
+    return smaller;
+}
+
+Board removeColumn(const Board& board, size_t column)
+{
+    Board smaller;
+    smaller.rows = board.rows;
+    smaller.columns = board.columns - 1;
+    for (size_t cell{0}; cell < board.table.size(); cell++)
+    {
+        if (cell % board.columns != column)
+        {
+            smaller.table.push_back(board.table[cell]);
+        }
+    }
+    return smaller;
+}
+
+// Reads the next line which isn't empty or a comment; returns false at the end of the input
+bool readLine(std::istream& in, std::string& line)
+{
+    while (std::getline(in, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        if (!line.empty() && line.front() != '#')
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t readCount(std::istream& in, std::string_view keyword, std::string& line)
+{
+    if (!readLine(in, line))
+    {
+        throw std::invalid_argument("Fuzz case ends before \"" + std::string(keyword) + "\"");
+    }
+    std::istringstream fields(line);
+    std::string name;
+    size_t count{0};
+    if (!(fields >> name >> count) || name != keyword)
+    {
+        throw std::invalid_argument("Expected \"" + std::string(keyword)
+                                    + " COUNT\" in fuzz case, got: " + line);
+    }
+    return count;
+}
+// Compares the distinct words engine finds in fuzzCase with the words of the reference
+std::optional<FuzzMismatch> compareWithReference(const SolverEngine& engine,
+                                                 const FuzzCase& fuzzCase,
+                                                 const std::vector<std::string>& expected)
+{
+    FuzzMismatch mismatch;
+    mismatch.engine = engine.name;
+    const bool mustReject{!engine.supportsBlanks && fuzzCase.board.hasWildcard()};
+
+    std::vector<std::string> found;
+    try
+    {
+        const std::vector<std::string_view> words(fuzzCase.words.begin(), fuzzCase.words.end());
+        const Trie wordsTrie{words};
+        const BoardSolver solve{engine.prepare(wordsTrie)};
+        found = sortedDistinct(solve(fuzzCase.board));
+    }
+    catch (const std::invalid_argument& e)
+    {
+        if (mustReject)
+        {
+            return std::nullopt;
+        }
+        mismatch.error = e.what();
+        return mismatch;
+    }
+    catch (const std::exception& e)
+    {
+        mismatch.error = e.what();
+        return mismatch;
+    }
+    if (mustReject)
+    {
+        mismatch.error = "Solved a board with blank tiles instead of rejecting it";
+        return mismatch;
+    }
+
+    std::set_difference(expected.begin(), expected.end(), found.begin(), found.end(),
+                        std::back_inserter(mismatch.missing));
+    std::set_difference(found.begin(), found.end(), expected.begin(), expected.end(),
+                        std::back_inserter(mismatch.extra));
+    if (mismatch.missing.empty() && mismatch.extra.empty())
+    {
+        return std::nullopt;
+    }
+    return mismatch;
+}
+} // namespace
+
+FuzzCase generateFuzzCase(uint64_t seed, uint64_t index, const FuzzConfig& config)
+{
+    FastRandom random{BoardGenerator::streamSeed(seed, index)};
+    auto below = [&random](size_t bound)
+    { return static_cast<size_t>(random.below(static_cast<uint32_t>(bound))); };
+
+    FuzzCase fuzzCase;
+    Board& board = fuzzCase.board;
+    board.rows = 1 + below(config.maxSide);
+    board.columns = 1 + below(config.maxSide);
+
+    // At least two distinct letters: on a board of a single letter the number of paths, which
+    // the engines report a word for, grows exponentially with the word length
+    std::string alphabet;
+    const size_t alphabetSize{2 + below(5)};
+    while (alphabet.size() < alphabetSize)
+    {
+        const auto letter = static_cast<char>('A' + below(26));
+        if (alphabet.find(letter) == std::string::npos)
+        {
+            alphabet.push_back(letter);
+        }
+    }
+    board.table.resize(board.rows * board.columns);
+    for (char& letter : board.table)
+    {
+        letter = alphabet[below(alphabet.size())];
+    }
+    if (below(4) == 0)
+    {
+        for (size_t nBlanks{1 + below(2)}; nBlanks > 0; nBlanks--)
+        {
+            board.table[below(board.table.size())] = wildcardTile;
+        }
+    }
+    // Letter read from a cell for a word, a letter of the alphabet for a blank tile
+    auto letterOf = [&](size_t cell)
+    {
+        return board.table[cell] == wildcardTile ? alphabet[below(alphabet.size())]
+                                                 : board.table[cell];
+    };
+
+    const size_t nWords{below(config.maxWords + 1)};
+    for (size_t i{0}; i < nWords; i++)
+    {
+        const size_t length{1 + below(config.maxWordLength)};
+        std::string word;
+        if (!fuzzCase.words.empty() && below(4) == 0)
+        {
+            // A prefix of an earlier word
+            const std::string& earlier = fuzzCase.words[below(fuzzCase.words.size())];
+            word = earlier.substr(0, 1 + below(earlier.size()));
+        }
+        else if (below(2) == 0)
+        {
+            // Letters along a random walk, which may revisit cells
+            size_t cell{below(board.table.size())};
+            word.push_back(letterOf(cell));
+            while (word.size() < length)
+            {
+                const auto neighbours = neighboursOf(board, cell);
+                if (neighbours.empty())
+                {
+                    break;
+                }
+                cell = neighbours[below(neighbours.size())];
+                word.push_back(letterOf(cell));
+            }
+        }
+        else
+        {
+            // Random letters, mostly of the board's alphabet
+            while (word.size() < length)
+            {
+                word.push_back(below(8) == 0 ? static_cast<char>('A' + below(26))
+                                             : alphabet[below(alphabet.size())]);
+            }
+        }
+        fuzzCase.words.push_back(std::move(word));
+    }
+    return fuzzCase;
+}
+
+std::vector<std::string> solveReference(const FuzzCase& fuzzCase)
+{
+    const Board& board = fuzzCase.board;
+    std::vector<bool> visited(board.table.size(), false);
+    std::vector<std::string> found;
+    for (const auto& word : sortedDistinct(fuzzCase.words))
+    {
+        for (size_t cell{0}; cell < board.table.size() && !word.empty(); cell++)
+        {
+            if (spellsFrom(board, word, 0, cell, visited))
+            {
+                found.push_back(word);
+                break;
+            }
+        }
+    }
+    return found;
+}
+
+std::optional<FuzzMismatch> checkEngine(const SolverEngine& engine, const FuzzCase& fuzzCase)
+{
+    return compareWithReference(engine, fuzzCase, solveReference(fuzzCase));
+}
+
+FuzzCase minimizeFuzzCase(const FuzzCase& fuzzCase, const SolverEngine& engine)
+{
+    FuzzCase current{fuzzCase};
+    auto keepIfFailing = [&engine, &current](FuzzCase&& candidate)
+    {
+        if (!checkEngine(engine, candidate))
+        {
+            return false;
+        }
+        current = std::move(candidate);
+        return true;
+    };
+
+    bool shrunk{true};
+    while (shrunk)
+    {
+        shrunk = false;
+
+        // Drop chunks of words, halving the chunk size down to single words
+        for (size_t chunk{std::max<size_t>(current.words.size() / 2, 1)}; chunk > 0; chunk /= 2)
+        {
+            for (size_t start{0}; start < current.words.size();)
+            {
+                FuzzCase candidate{current};
+                const auto first = candidate.words.begin() + static_cast<std::ptrdiff_t>(start);
+                candidate.words.erase(
+                    first, first + static_cast<std::ptrdiff_t>(
+                                       std::min(chunk, candidate.words.size() - start)));
+                if (keepIfFailing(std::move(candidate)))
+                {
+                    shrunk = true;
+                }
+                else
+                {
+                    start += chunk;
+                }
+            }
+        }
+
+        // Shorten words from either end
+        for (size_t i{0}; i < current.words.size(); i++)
+        {
+            while (current.words[i].size() > 1)
+            {
+                FuzzCase withoutLast{current};
+                withoutLast.words[i].pop_back();
+                FuzzCase withoutFirst{current};
+                withoutFirst.words[i].erase(0, 1);
+                if (!keepIfFailing(std::move(withoutLast))
+                    && !keepIfFailing(std::move(withoutFirst)))
+                {
+                    break;
+                }
+                shrunk = true;
+            }
+        }
+
+        // Remove board rows and columns
+        for (size_t row{0}; row < current.board.rows && current.board.rows > 1;)
+        {
+            FuzzCase candidate{current};
+            candidate.board = removeRow(current.board, row);
+            if (keepIfFailing(std::move(candidate)))
+            {
+                shrunk = true;
+            }
+            else
+            {
+                row++;
+            }
+        }
+        for (size_t column{0}; column < current.board.columns && current.board.columns > 1;)
+        {
+            FuzzCase candidate{current};
+            candidate.board = removeColumn(current.board, column);
+            if (keepIfFailing(std::move(candidate)))
+            {
+                shrunk = true;
+            }
+            else
+            {
+                column++;
+            }
+        }
+    }
+    return current;
+}
+
+FuzzRunResult runDifferentialFuzz(const std::vector<SolverEngine>& engines,
+                                  const FuzzConfig& config, uint64_t seed, size_t nCases,
+                                  size_t nThreads)
+{
+    std::atomic<uint64_t> nextIndex{0};
+    std::atomic<uint64_t> firstFailingIndex{nCases};
+    std::atomic<size_t> casesRun{0};
+    std::mutex failureMutex;
+    std::optional<FuzzFailure> failure;
+    const SolverEngine* failingEngine{nullptr};
+
+    // Cases are claimed in increasing order and only cases after a failure are skipped, so every
+    // case before the first failure is checked
+    auto work = [&]
+    {
+        for (uint64_t index{nextIndex++}; index < firstFailingIndex.load(); index = nextIndex++)
+        {
+            FuzzCase fuzzCase{generateFuzzCase(seed, index, config)};
+            const auto expected = solveReference(fuzzCase);
+            for (const auto& engine : engines)
+            {
+                auto mismatch = compareWithReference(engine, fuzzCase, expected);
+                if (!mismatch)
+                {
+                    continue;
+                }
+
+                std::lock_guard lock(failureMutex);
+                if (index < firstFailingIndex.load())
+                {
+                    firstFailingIndex = index;
+                    failure = FuzzFailure{index, std::move(fuzzCase), {}, std::move(*mismatch)};
+                    failingEngine = &engine;
+                }
+                break;
+            }
+            casesRun++;
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (size_t i{1}; i < std::max<size_t>(nThreads, 1); i++)
+    {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    if (failure)
+    {
+        failure->minimized = minimizeFuzzCase(failure->original, *failingEngine);
+        failure->mismatch = checkEngine(*failingEngine, failure->minimized).value();
+    }
+    return {casesRun.load(), std::move(failure)};
+}
+
+void writeFuzzCase(std::ostream& out, const FuzzCase& fuzzCase)
+{
+    const Board& board = fuzzCase.board;
+    out << "board " << board.rows << " " << board.columns << "\n";
+    for (size_t r{0}; r < board.rows; r++)
+    {
+        out << std::string_view(board.table.data() + r * board.columns, board.columns) << "\n";
+    }
+    out << "words " << fuzzCase.words.size() << "\n";
+    for (const auto& word : fuzzCase.words)
+    {
+        out << word << "\n";
+    }
+}
+
+FuzzCase readFuzzCase(std::istream& in)
+{
+    FuzzCase fuzzCase;
+    std::string line;
+
+    Board& board = fuzzCase.board;
+    std::istringstream header;
+    if (!readLine(in, line))
+    {
+        throw std::invalid_argument("Empty fuzz case");
+    }
+    header.str(line);
+    std::string keyword;
+    if (!(header >> keyword >> board.rows >> board.columns) || keyword != "board"
+        || board.rows == 0 || board.columns == 0)
+    {
+        throw std::invalid_argument("Expected \"board ROWS COLUMNS\" in fuzz case, got: " + line);
+    }
+    for (size_t r{0}; r < board.rows; r++)
+    {
+        if (!readLine(in, line) || line.size() != board.columns)
+        {
+            throw std::invalid_argument("Fuzz case board row " + std::to_string(r)
+                                        + " doesn't have " + std::to_string(board.columns)
+                                        + " letters");
+        }
+        board.table.insert(board.table.end(), line.begin(), line.end());
+    }
+
+    const size_t nWords{readCount(in, "words", line)};
+    for (size_t i{0}; i < nWords; i++)
+    {
+        if (!readLine(in, line))
+        {
+            throw std::invalid_argument("Fuzz case has fewer than " + std::to_string(nWords)
+                                        + " words");
+        }
+        fuzzCase.words.push_back(line);
+    }
+    return fuzzCase;
+}
@@ -0,0 +1,90 @@
+#ifndef DIFFERENTIAL_FUZZER_H
+#define DIFFERENTIAL_FUZZER_H
+
+#include "Board.h"
+#include "boggle_engines.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <vector>
+
+// A board and the dictionary it is solved with
+struct FuzzCase
+{
+    Board board{};
+    std::vector<std::string> words{};
+};
+
+// Shape of the generated cases
+// Boards use a small random alphabet (2 to 6 letters), so that letters repeat and paths cross,
+// and half of the dictionary words are read along random walks of the board (which may revisit
+// cells, making words that can't be spelled), so that every case exercises hits, near misses and
+// prefixes. A quarter of the boards have one or two blank tiles (wildcardTile), which engines
+// without supportsBlanks must reject.
+struct FuzzConfig
+{
+    size_t maxSide{6};
+    size_t maxWords{48};
+    size_t maxWordLength{8};
+};
+
+// An engine whose words differ from the reference (or which threw)
+struct FuzzMismatch
+{
+    std::string engine{};
+    std::vector<std::string> missing{}; // found by the reference only
+    std::vector<std::string> extra{};   // found by the engine only
+    std::string error{};                // what() of the exception thrown by the engine, if any
+};
+
+// First failing case of a fuzzing run
+struct FuzzFailure
+{
+    uint64_t caseIndex{0};
+    FuzzCase original{};
+    FuzzCase minimized{};
+    FuzzMismatch mismatch{}; // of the minimized case
+};
+
+struct FuzzRunResult
+{
+    size_t casesRun{0};
+    std::optional<FuzzFailure> failure{};
+};
+
+// Function to generate case number index of the run with the given seed
+FuzzCase generateFuzzCase(uint64_t seed, uint64_t index, const FuzzConfig& config);
+
+// Function to find the distinct words of a case, sorted, by searching every dictionary word on
+// the board with a plain depth-first search (no trie, no pruning), as the reference for engines
+// A blank tile matches any letter of a word
+std::vector<std::string> solveReference(const FuzzCase& fuzzCase);
+
+// Function to compare the distinct words an engine finds with the reference
+// On a board with a blank tile, an engine without supportsBlanks must throw std::invalid_argument
+std::optional<FuzzMismatch> checkEngine(const SolverEngine& engine, const FuzzCase& fuzzCase);
+
+// Function to shrink a case on which engine mismatches, keeping it mismatching
+// Dictionary words are dropped (in halving chunks, then one by one) and shortened, and board rows
+// and columns are removed, until no single step keeps the mismatch.
+FuzzCase minimizeFuzzCase(const FuzzCase& fuzzCase, const SolverEngine& engine);
+
+// Function to check nCases cases of a seed against every engine using nThreads threads
+// Stops at the first failing case, which is the same whatever the number of threads, and minimizes
+// it for the first engine which mismatches.
+FuzzRunResult runDifferentialFuzz(const std::vector<SolverEngine>& engines,
+                                  const FuzzConfig& config, uint64_t seed, size_t nCases,
+                                  size_t nThreads);
+
+// Function to write a case as text: "board ROWS COLUMNS", one line of letters per row,
+// "words COUNT" and one word per line
+void writeFuzzCase(std::ostream& out, const FuzzCase& fuzzCase);
+
+// Function to read a case written by writeFuzzCase; lines starting with '#' are comments
+// Throws std::invalid_argument if the text isn't a valid case
+FuzzCase readFuzzCase(std::istream& in);
+
+#endif // DIFFERENTIAL_FUZZER_H
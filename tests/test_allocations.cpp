@@ -0,0 +1,133 @@
+#include "Board.h"
+#include "BoardGenerator.h"
+#include "PackedTrie.h"
+#include "Trie.h"
+#include "TrieTable.h"
+#include "allocation_tracker.h"
+#include "boggle_algorithm.h"
+#include "boggle_packed.h"
+#include "word_list.h"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Paths designated allocation-free; they only run in an allocation-tracking build
+// (-DBOGGLE_TRACK_ALLOCATIONS=ON)
+class AllocationTest : public ::testing::Test
+{
+protected:
+    AllocationTest() : wordsTrie{EXTENDED_WORD_LIST}
+    {
+    }
+
+    [[maybe_unused]] void SetUp() override
+    {
+        if (!allocationTrackingEnabled)
+        {
+            GTEST_SKIP() << "Allocation tracking is disabled";
+        }
+    }
+
+    Trie wordsTrie;
+};
+
+TEST_F(AllocationTest, TrackerCountsAllocations)
+{
+    // Direct calls, as the compiler may elide the allocation of a new-expression
+    AllocationScope scope;
+    void* memory = ::operator new(400);
+    ::operator delete(memory);
+    const AllocationStats stats{scope.stats()};
+
+    EXPECT_EQ(stats.allocations, 1u);
+    EXPECT_EQ(stats.deallocations, 1u);
+    EXPECT_EQ(stats.bytes, 400u);
+}
+
+TEST_F(AllocationTest, TrieContainsIsAllocationFree)
+{
+    AllocationScope scope;
+    size_t nWords{0};
+    for (const auto word : EXTENDED_WORD_LIST)
+    {
+        nWords += wordsTrie.contains(word) == inTrie::isWord ? 1u : 0u;
+        nWords += wordsTrie.contains(word.substr(0, 2)) == inTrie::isWord ? 1u : 0u;
+    }
+
+    EXPECT_GE(nWords, EXTENDED_WORD_LIST.size());
+    EXPECT_EQ(scope.stats().allocations, 0u);
+}
+
+TEST_F(AllocationTest, TallyWithWarmScratchIsAllocationFree)
+{
+    BoardGenerator generator{DiceSet::classic4x4, 16, 16, 7};
+    const Board first{generator.next()};
+    const Board second{generator.next()};
+
+    TallyScratch scratch;
+    tallyValidWordsInBoard(wordsTrie, first, {}, scratch);
+
+    AllocationScope scope;
+    const auto tally = tallyValidWordsInBoard(wordsTrie, second, {}, scratch);
+
+    EXPECT_GT(tally.wordCount, 0u);
+    EXPECT_EQ(scope.stats().allocations, 0u);
+}
+
+TEST_F(AllocationTest, TableAndPackedStepsAreAllocationFree)
+{
+    const TrieTable wordsTable{wordsTrie};
+    const PackedTrie packedTrie{wordsTrie};
+
+    AllocationScope scope;
+    size_t nWords{0};
+    for (const auto word : EXTENDED_WORD_LIST)
+    {
+        uint32_t state{TrieTable::rootState};
+        uint32_t node{PackedTrie::rootIndex};
+        for (const char letter : word)
+        {
+            state = wordsTable.step(state, letter);
+            node = packedTrie.findChild(node, letter);
+        }
+        nWords += (wordsTable.isWord(state) && packedTrie.isWord(node)) ? 1u : 0u;
+    }
+
+    EXPECT_EQ(nWords, EXTENDED_WORD_LIST.size());
+    EXPECT_EQ(scope.stats().allocations, 0u);
+}
+
+TEST_F(AllocationTest, BoardGeneratorRollIsAllocationFree)
+{
+    BoardGenerator generator{DiceSet::bigBoggle5x5, 3};
+    std::vector<char> buffer(100 * 25);
+
+    AllocationScope scope;
+    generator.generate(buffer, 100);
+
+    EXPECT_EQ(scope.stats().allocations, 0u);
+}
+
+TEST_F(AllocationTest, TrieAndSolveOnArenaAreAllocationFree)
+{
+    const PackedTrie packedTrie{wordsTrie};
+    BoardGenerator generator{DiceSet::classic4x4, 16, 16, 11};
+    const Board board{generator.next()};
+    std::vector<std::byte> buffer(8 * 1024 * 1024);
+
+    AllocationScope scope;
+    size_t nWords{0};
+    {
+        std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size(),
+                                                  std::pmr::null_memory_resource()};
+        const Trie arenaTrie{EXTENDED_WORD_LIST, &arena};
+        nWords += arenaTrie.getNodeCount() > 1 ? 1u : 0u;
+        nWords += findValidWordsInBoardPacked(packedTrie, board, &arena).size();
+    }
+
+    EXPECT_GT(nWords, 1u);
+    EXPECT_EQ(scope.stats().allocations, 0u);
+}
@@ -0,0 +1,142 @@
+#include "Alphabet.h"
+#include "Board.h"
+#include "PackedTrie.h"
+#include "Trie.h"
+#include "TrieTable.h"
+#include "boggle_algorithm.h"
+#include "boggle_lockstep.h"
+#include "boggle_packed.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+class AlphabetTest : public ::testing::Test
+{
+protected:
+    AlphabetTest() : words{}
+    {
+    }
+
+    [[maybe_unused]] void SetUp() override
+    {
+        // German, Spanish and Greek words mixed with ASCII ones
+        words = {"BÄR", "ÄRA", "NIÑO", "AÑO", "ΣΟΦΙΑ", "ΦΩΣ", "ONE", "NO"};
+    }
+
+    static std::vector<std::string> sorted(std::vector<std::string> values)
+    {
+        std::sort(values.begin(), values.end());
+        return values;
+    }
+
+    std::vector<std::string_view> words;
+};
+
+TEST_F(AlphabetTest, EncodesEverySymbolDensely)
+{
+    Alphabet alphabet{words};
+
+    // A B E I N O R Ä Ñ Σ Φ Ω Ο Ι Α(Greek) -> every distinct code point once
+    EXPECT_EQ(alphabet.size(), 15u);
+
+    for (const auto word : words)
+    {
+        auto encoded = alphabet.encode(word);
+        EXPECT_EQ(alphabet.decode(encoded), word);
+
+        for (const char code : encoded)
+        {
+            EXPECT_LT(static_cast<uint8_t>(code), alphabet.size());
+        }
+    }
+
+    EXPECT_EQ(alphabet.encode("NIÑO").size(), 4u);
+    EXPECT_EQ(alphabet.codeOf(U'Z'), Alphabet::unknownCode);
+    EXPECT_EQ(alphabet.symbolOf(alphabet.codeOf(U'Σ')), "Σ");
+}
+
+TEST_F(AlphabetTest, CodesFollowCodePointOrder)
+{
+    Alphabet alphabet{words};
+    auto encoded = alphabet.encodeWords(words);
+
+    std::vector<std::string> utf8(words.begin(), words.end());
+    EXPECT_EQ(alphabet.decodeWords(sorted(encoded)), sorted(utf8));
+}
+
+TEST_F(AlphabetTest, RejectsMalformedUtf8)
+{
+    Alphabet alphabet{words};
+
+    EXPECT_THROW(alphabet.encode("\xC3"), std::invalid_argument);         // truncated
+    EXPECT_THROW(alphabet.encode("\xC0\x80"), std::invalid_argument);     // overlong
+    EXPECT_THROW(alphabet.encode("\xED\xA0\x80"), std::invalid_argument); // surrogate
+    EXPECT_THROW(alphabet.encode("\x80"), std::invalid_argument);         // stray continuation
+    EXPECT_THROW(alphabet.encodeBoard(2, 2, "ABC"), std::invalid_argument);
+}
+
+TEST_F(AlphabetTest, SolversFindMultiByteWords)
+{
+    Alphabet alphabet{words};
+    auto encodedWords = alphabet.encodeWords(words);
+    Trie wordsTrie{std::vector<std::string_view>(encodedWords.begin(), encodedWords.end())};
+
+    // B Ä R X
+    // Ñ O N Z
+    // Φ Ω Σ A
+    Board board = alphabet.encodeBoard(3, 4, "BÄRXÑONZΦΩΣA");
+    EXPECT_EQ(board.table[3], static_cast<char>(Alphabet::unknownCode));
+
+    std::vector<std::string> expected{"BÄR", "NO", "ΦΩΣ"};
+
+    auto recursive = alphabet.decodeWords(findValidWordsInBoardRecursive(wordsTrie, board));
+    EXPECT_EQ(sorted(recursive), sorted(expected));
+
+    auto iterative = alphabet.decodeWords(findValidWordsInBoardIterative(wordsTrie, board));
+    EXPECT_EQ(sorted(iterative), sorted(expected));
+
+    // The transition table is sized to the alphabet (plus the "other" column)
+    TrieTable wordsTable{wordsTrie, alphabet};
+    EXPECT_EQ(wordsTable.columnCount(), alphabet.codeCount() + 1);
+
+    auto lockstep = findValidWordsInBoardsLockstep(wordsTable, {board});
+    EXPECT_EQ(sorted(alphabet.decodeWords(lockstep[0])), sorted(expected));
+
+    // Scores count symbols, not bytes
+    EXPECT_EQ(tallyValidWordsInBoard(wordsTrie, board).score, 2u);
+}
+
+TEST_F(AlphabetTest, ReservesTheWildcardCode)
+{
+    // 100 symbols, from U+0100: more than the codes below the blank tile's
+    std::vector<std::string> symbols;
+    for (char32_t codePoint{0x100}; codePoint < 0x164; codePoint++)
+    {
+        symbols.push_back(encodeUtf8(codePoint));
+    }
+    const std::vector<std::string_view> symbolWords(symbols.begin(), symbols.end());
+    Alphabet alphabet{symbolWords};
+    EXPECT_EQ(alphabet.size(), 100u);
+    EXPECT_EQ(alphabet.codeCount(), 101u);
+    for (const auto symbol : symbolWords)
+    {
+        const auto code = static_cast<uint8_t>(alphabet.encode(symbol).front());
+        EXPECT_NE(code, Alphabet::wildcardCode);
+        EXPECT_LT(code, alphabet.codeCount());
+        EXPECT_EQ(alphabet.symbolOf(code), symbol);
+    }
+
+    // '?' on a board is a blank tile, which the 64th symbol doesn't match
+    const std::string word{symbols[0] + symbols[63]};
+    const auto encodedWords = alphabet.encodeWords({word});
+    const Trie wordsTrie{std::vector<std::string_view>(encodedWords.begin(), encodedWords.end())};
+    const PackedTrie packedTrie{wordsTrie};
+    const Board board = alphabet.encodeBoard(1, 2, symbols[0] + "?");
+    EXPECT_EQ(board.table[1], wildcardTile);
+    EXPECT_EQ(alphabet.decodeWords(findValidWordsInBoardPacked(packedTrie, board)),
+              std::vector<std::string>{word});
+    EXPECT_EQ(alphabet.decode(std::string(1, board.table[1])), "?");
+    EXPECT_THROW(findValidWordsInBoardRecursive(wordsTrie, board), std::invalid_argument);
+}
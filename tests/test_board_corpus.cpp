@@ -0,0 +1,117 @@
+#include "Board.h"
+#include "BoardCorpus.h"
+#include "BoardGenerator.h"
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+// Board corpus files, written to the temporary directory under the name of the test, so that tests
+// running in parallel don't share a file
+class BoardCorpusTest : public ::testing::Test
+{
+protected:
+    BoardCorpusTest()
+        : path{(std::filesystem::temp_directory_path()
+                / (std::string("boggle_test_corpus_")
+                   + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".bin"))
+                   .string()}
+    {
+    }
+
+    [[maybe_unused]] void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+
+    std::string path;
+};
+
+TEST_F(BoardCorpusTest, PackedBoardsRoundTrip)
+{
+    for (const auto& [rows, columns] : {std::pair<size_t, size_t>{4, 4}, {5, 7}, {1, 1}, {33, 9}})
+    {
+        BoardGenerator generator{DiceSet::classic4x4, rows, columns, 3};
+        std::vector<Board> boards;
+        {
+            BoardCorpusWriter writer{path, rows, columns, true, true};
+            for (uint64_t i{0}; i < 100; i++)
+            {
+                boards.push_back(generator.next());
+                writer.add(boards.back(), i * 1000 + 7);
+            }
+            EXPECT_EQ(writer.boardCount(), 100u);
+        }
+
+        const BoardCorpus corpus{path};
+        ASSERT_EQ(corpus.size(), boards.size());
+        EXPECT_EQ(corpus.rows(), rows);
+        EXPECT_EQ(corpus.columns(), columns);
+        EXPECT_TRUE(corpus.hasTimestamps());
+        EXPECT_EQ(corpus.fileSizeBytes(), 32 + 100 * ((rows * columns * 5 + 7) / 8 + 8));
+        Board decoded;
+        for (size_t i{0}; i < boards.size(); i++)
+        {
+            corpus.decode(i, decoded);
+            EXPECT_EQ(decoded.table, boards[i].table);
+            EXPECT_EQ(corpus.timestampNs(i), i * 1000 + 7);
+        }
+    }
+}
+
+TEST_F(BoardCorpusTest, UnpackedBoardsKeepAnyByte)
+{
+    Board board;
+    board.rows = 2;
+    board.columns = 3;
+    board.table = {'a', '?', '\0', static_cast<char>(0xc3), 'Z', 'Q'};
+    {
+        BoardCorpusWriter packed{path, 2, 3, true, false};
+        EXPECT_THROW(packed.add(board), std::invalid_argument);
+    }
+    {
+        BoardCorpusWriter writer{path, 2, 3, false, false};
+        writer.add(board);
+        writer.add(board);
+        EXPECT_THROW(writer.add(Board{}), std::invalid_argument);
+        writer.finish();
+    }
+
+    const BoardCorpus corpus{path};
+    ASSERT_EQ(corpus.size(), 2u);
+    EXPECT_FALSE(corpus.hasTimestamps());
+    EXPECT_EQ(corpus.timestampNs(1), 0u);
+    EXPECT_EQ(corpus.board(0).table, board.table);
+    EXPECT_EQ(corpus.board(1).table, board.table);
+}
+
+TEST_F(BoardCorpusTest, InvalidFilesAreRejected)
+{
+    EXPECT_THROW(BoardCorpus{path + ".missing"}, std::runtime_error);
+    EXPECT_THROW(BoardCorpusWriter(path, 0, 4, true, false), std::invalid_argument);
+
+    {
+        BoardCorpusWriter writer{path, 4, 4, true, false};
+        writer.add(BoardGenerator{DiceSet::classic4x4, 1}.next());
+    }
+    const auto size = std::filesystem::file_size(path);
+
+    // Truncated
+    std::filesystem::resize_file(path, size - 1);
+    EXPECT_THROW(BoardCorpus{path}, std::runtime_error);
+
+    // Bad magic
+    std::filesystem::resize_file(path, size);
+    {
+        std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+        file.put('X');
+    }
+    EXPECT_THROW(BoardCorpus{path}, std::runtime_error);
+
+    // Not even a header
+    std::ofstream{path} << "BOG";
+    EXPECT_THROW(BoardCorpus{path}, std::runtime_error);
+}
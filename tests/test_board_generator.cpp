@@ -0,0 +1,143 @@
+#include "Board.h"
+#include "BoardGenerator.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+TEST(FastRandomTest, SameSeedSameSequence)
+{
+    FastRandom first{42};
+    FastRandom second{42};
+    FastRandom other{43};
+
+    bool differs{false};
+    for (int i{0}; i < 100; i++)
+    {
+        const uint64_t value{first.next()};
+        EXPECT_EQ(value, second.next());
+        differs = differs || value != other.next();
+    }
+    EXPECT_TRUE(differs);
+}
+
+TEST(FastRandomTest, BelowStaysInRange)
+{
+    FastRandom random{7};
+    std::vector<int> histogram(6, 0);
+    for (int i{0}; i < 6000; i++)
+    {
+        const uint32_t value{random.below(6)};
+        ASSERT_LT(value, 6u);
+        histogram[value]++;
+    }
+    for (const int count : histogram)
+    {
+        EXPECT_GT(count, 800);
+    }
+}
+
+TEST(BoardGeneratorTest, DiceSetSizes)
+{
+    EXPECT_EQ(getDice(DiceSet::classic4x4).size(), 16u);
+    EXPECT_EQ(getDice(DiceSet::bigBoggle5x5).size(), 25u);
+    EXPECT_EQ(getDice(DiceSet::superBigBoggle6x6).size(), 36u);
+    for (const auto diceSet :
+         {DiceSet::classic4x4, DiceSet::bigBoggle5x5, DiceSet::superBigBoggle6x6})
+    {
+        for (const auto die : getDice(diceSet))
+        {
+            EXPECT_EQ(die.size(), 6u) << die;
+        }
+    }
+}
+
+TEST(BoardGeneratorTest, DeterministicForSeed)
+{
+    BoardGenerator first{DiceSet::classic4x4, 2024};
+    BoardGenerator second{DiceSet::classic4x4, 2024};
+    BoardGenerator other{DiceSet::classic4x4, 2025};
+
+    bool differs{false};
+    for (int i{0}; i < 50; i++)
+    {
+        const Board board{first.next()};
+        EXPECT_EQ(board.rows, 4u);
+        EXPECT_EQ(board.columns, 4u);
+        EXPECT_EQ(board.table, second.next().table);
+        differs = differs || board.table != other.next().table;
+    }
+    EXPECT_TRUE(differs);
+}
+
+TEST(BoardGeneratorTest, EveryDieIsUsedOnce)
+{
+    const auto& dice = getDice(DiceSet::bigBoggle5x5);
+    BoardGenerator generator{DiceSet::bigBoggle5x5, 1};
+
+    for (int i{0}; i < 100; i++)
+    {
+        const Board board{generator.next()};
+
+        // Match every letter to a distinct die showing it (augmenting paths, bipartite matching)
+        std::vector<size_t> cellOfDie(dice.size(), board.table.size());
+        auto assign = [&](auto& self, size_t cell, std::vector<bool>& tried) -> bool
+        {
+            for (size_t die{0}; die < dice.size(); die++)
+            {
+                if (!tried[die] && dice[die].find(board.table[cell]) != std::string_view::npos)
+                {
+                    tried[die] = true;
+                    if (cellOfDie[die] == board.table.size()
+                        || self(self, cellOfDie[die], tried))
+                    {
+                        cellOfDie[die] = cell;
+                        return true;
+                    }
+                }
+            }
+            return false;
+        };
+
+        bool matched{true};
+        for (size_t cell{0}; cell < board.table.size(); cell++)
+        {
+            std::vector<bool> tried(dice.size(), false);
+            matched = matched && assign(assign, cell, tried);
+        }
+        EXPECT_TRUE(matched)
+            << std::string(board.table.begin(), board.table.end());
+    }
+}
+
+TEST(BoardGeneratorTest, BulkMatchesSequential)
+{
+    BoardGenerator sequential{DiceSet::superBigBoggle6x6, 99};
+    BoardGenerator bulk{DiceSet::superBigBoggle6x6, 99};
+
+    constexpr size_t count{20};
+    std::vector<char> buffer(count * 36);
+    bulk.generate(buffer, count);
+
+    for (size_t i{0}; i < count; i++)
+    {
+        const Board board{sequential.next()};
+        EXPECT_TRUE(std::equal(board.table.begin(), board.table.end(),
+                               buffer.begin() + static_cast<std::ptrdiff_t>(36 * i)));
+    }
+
+    EXPECT_THROW(bulk.generate(buffer, count + 1), std::invalid_argument);
+}
+
+TEST(BoardGeneratorTest, ParallelOutputIndependentOfThreads)
+{
+    constexpr size_t count{5000};
+    std::vector<char> single(count * 64);
+    std::vector<char> multi(count * 64);
+
+    generateBoardsParallel(DiceSet::classic4x4, 8, 8, 5, single, count, 1);
+    generateBoardsParallel(DiceSet::classic4x4, 8, 8, 5, multi, count, 4);
+    EXPECT_EQ(single, multi);
+}
@@ -126,6 +126,20 @@ TEST_F(BoggleTest, AlgorithmsProduceSameResults)
     }
 }
 
+TEST_F(BoggleTest, WordPathsMatchRecursiveWords)
+{
+    Trie wordsTrie{wordsList};
+
+    std::vector<std::string> pathWords;
+    for (const auto& wordPath : findWordPathsInBoard(wordsTrie, board))
+    {
+        EXPECT_EQ(wordPath.word.size(), wordPath.cells.size()) << wordPath.word;
+        pathWords.push_back(wordPath.word);
+    }
+
+    EXPECT_EQ(pathWords, findValidWordsInBoardRecursive(wordsTrie, board));
+}
+
 TEST_F(BoggleTest, PerformanceMeasurement)
 {
     Trie wordsTrie{wordsList};
@@ -1,15 +1,48 @@
 #include "Board.h"
+#include "BoardGenerator.h"
+#include "MultiTrie.h"
+#include "PackedTrie.h"
+#include "PerfectHashDictionary.h"
+#include "SolutionIndex.h"
 #include "Trie.h"
+#include "TrieTable.h"
+#include "WordIdSet.h"
+#include "WordIndex.h"
+#include "ZOrderBoard.h"
+#include "allocation_tracker.h"
 #include "boggle_algorithm.h"
+#include "boggle_anytime.h"
+#include "boggle_counters.h"
+#include "boggle_dictionary.h"
+#include "boggle_engines.h"
+#include "boggle_interleaved.h"
+#include "boggle_level_sync.h"
+#include "boggle_lockstep.h"
+#include "boggle_memo.h"
+#include "boggle_multi.h"
+#include "boggle_packed.h"
+#include "boggle_pipeline.h"
+#include "boggle_word_driven.h"
+#include "boggle_word_ids.h"
 #include "create_boggle_board.h"
 #include "word_list.h"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
 #include <functional>
 #include <gtest/gtest.h>
 #include <iomanip>
+#include <iterator>
+#include <memory_resource>
 #include <numeric>
+#include <random>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -20,16 +53,59 @@ protected:
     using Duration = std::chrono::microseconds;
     using AlgorithmFunction = std::function<std::vector<std::string>(const Trie&, const Board&)>;
 
+    // Dictionary of random paths of 3 to 8 letters on random 16x16 boards (1000 per board), which
+    // has far more prefixes than the word list and keeps many paths alive on any board
+    static std::vector<std::string> randomPathWords(size_t count, uint64_t seed)
+    {
+        std::vector<std::string> randomWords;
+        std::mt19937_64 random{seed};
+        BoardGenerator generator{DiceSet::classic4x4, 16, 16, seed};
+        Board source{generator.next()};
+        while (randomWords.size() < count)
+        {
+            if (randomWords.size() % 1000 == 0)
+            {
+                source = generator.next();
+            }
+            size_t r{random() % source.rows};
+            size_t c{random() % source.columns};
+            std::vector<uint8_t> visited(source.table.size(), 0);
+            std::string word(1, source.getLetter(r, c));
+            visited[r * source.columns + c] = 1;
+            // Random steps to unvisited neighbours; a walk which gets stuck ends there
+            const size_t length{3 + random() % 6};
+            for (size_t attempt{0}; word.size() < length && attempt < 64; attempt++)
+            {
+                const size_t nextR{r + random() % 3};
+                const size_t nextC{c + random() % 3};
+                if (nextR == 0 || nextC == 0 || nextR > source.rows || nextC > source.columns
+                    || visited[(nextR - 1) * source.columns + nextC - 1] != 0)
+                {
+                    continue;
+                }
+                r = nextR - 1;
+                c = nextC - 1;
+                visited[r * source.columns + c] = 1;
+                word.push_back(source.getLetter(r, c));
+            }
+            randomWords.push_back(std::move(word));
+        }
+        return randomWords;
+    }
+
     // Map of algorithm names to their implementations
     std::unordered_map<std::string, AlgorithmFunction> algorithms
-        = {{"Recursive", findValidWordsInBoardRecursive},
-           {"Iterative", findValidWordsInBoardIterative}};
+        = {{"Recursive", [](const Trie& wordsTrie, const Board& board)
+            { return findValidWordsInBoardRecursive(wordsTrie, board); }},
+           {"Iterative", [](const Trie& wordsTrie, const Board& board)
+            { return findValidWordsInBoardIterative(wordsTrie, board); }}};
 
     // Measure performance of a single algorithm run
     Duration measureAlgorithmPerformance(const AlgorithmFunction& algorithmFunc,
                                          const Trie& wordsTrie, const Board& board,
                                          std::vector<std::string>& foundWords)
     {
+        resetSolveCounters();
         auto start = Clock::now();
         foundWords = algorithmFunc(wordsTrie, board);
         auto end = Clock::now();
@@ -99,7 +175,9 @@ protected:
                       << "  Board size: " << board.rows << "x" << board.columns << "\n"
                       << "  Mean execution time: " << result.meanDuration.count()
                       << " microseconds\n"
-                      << "  Words found: " << result.foundWords.size() << "\n";
+                      << "  Words found: " << result.foundWords.size() << "\n"
+                      << "  Counters (last run): ";
+            printSolveCounters(std::cout, threadSolveCounters());
         }
 
         // Calculate and print the ratio of recursive to iterative execution times
@@ -139,6 +217,47 @@ protected:
             }
         }
     }
+
+    // Measure boards/sec of the scalar batch path and the lockstep solver on a batch of boards
+    template <size_t Rows, size_t Columns>
+    void runBatchBenchmark(const std::string& listName, const auto& wordList, size_t nBoards)
+    {
+        Trie wordsTrie{wordList};
+        TrieTable wordsTable{wordsTrie};
+
+        std::vector<Board> boards;
+        for (size_t i = 0; i < nBoards; ++i)
+        {
+            boards.push_back(createBoggleBoard<Rows, Columns>());
+        }
+
+        auto boardsPerSecond = [nBoards](Duration duration)
+        {
+            return static_cast<double>(nBoards) * 1e6
+                   / static_cast<double>(std::max<Duration::rep>(duration.count(), 1));
+        };
+
+        std::cout << "\nBatch of " << nBoards << " boards (" << Rows << "x" << Columns << ") with "
+                  << listName << ":\n";
+
+        auto start = Clock::now();
+        auto scalarWords = findValidWordsInBoardsIterative(wordsTrie, boards);
+        auto scalarDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+        std::cout << "  Scalar (Iterative): " << std::fixed << std::setprecision(0)
+                  << boardsPerSecond(scalarDuration) << " boards/sec\n";
+
+        for (const size_t lanes : {8u, 16u, 32u})
+        {
+            start = Clock::now();
+            auto lockstepWords = findValidWordsInBoardsLockstep(wordsTable, boards, lanes);
+            auto lockstepDuration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+            std::cout << "  Lockstep (" << lanes << " lanes): " << boardsPerSecond(lockstepDuration)
+                      << " boards/sec\n";
+
+            EXPECT_EQ(lockstepWords, scalarWords) << "Lockstep with " << lanes << " lanes differs";
+        }
+    }
 };
 
 // Benchmark test for Huge Board with Extended Word List
@@ -147,3 +266,1155 @@ TEST_F(BoggleBenchmarkTest, HugeBoard_ExtendedList_Benchmark)
     runBenchmark("Huge Board (32x32)", createBoggleBoard<32, 32>(), "Extended Word List",
                  EXTENDED_WORD_LIST, 10);
 }
+
+// Benchmark of count-only, score-only and threshold solves against a full solve plus dedupe
+TEST_F(BoggleBenchmarkTest, HugeBoard_CountModes_Benchmark)
+{
+    Trie wordsTrie{EXTENDED_WORD_LIST};
+    Board board = createBoggleBoard<32, 32>();
+    constexpr int numIterations = 10;
+
+    auto timeMode = [&](const std::string& modeName, const auto& solve)
+    {
+        size_t result{0};
+        auto start = Clock::now();
+        for (int i = 0; i < numIterations; ++i)
+        {
+            result = solve();
+        }
+        auto mean = std::chrono::duration_cast<Duration>(Clock::now() - start) / numIterations;
+
+        std::cout << "  " << modeName << ": " << mean.count() << " microseconds (result " << result
+                  << ")\n";
+        return result;
+    };
+
+    std::cout << "\nCount modes on Huge Board (32x32) with Extended Word List:\n";
+
+    auto fullCount = timeMode("Iterative + dedupe",
+                              [&]()
+                              {
+                                  auto words = findValidWordsInBoardIterative(wordsTrie, board);
+                                  std::sort(words.begin(), words.end());
+                                  return static_cast<size_t>(
+                                      std::unique(words.begin(), words.end()) - words.begin());
+                              });
+    auto count = timeMode("Count only", [&]() { return countValidWordsInBoard(wordsTrie, board); });
+    timeMode("Score only", [&]() { return scoreValidWordsInBoard(wordsTrie, board); });
+
+    TallyScratch scratch;
+    timeMode("Threshold (50 words, reused scratch)",
+             [&]() { return tallyValidWordsInBoard(wordsTrie, board, {50, 0}, scratch).wordCount; });
+
+    EXPECT_EQ(count, fullCount);
+}
+
+// Benchmark of trie node layouts: solve time and modelled cache line switches per solve
+// The hot-first layout is built from a profile of sample boards other than the measured ones
+TEST_F(BoggleBenchmarkTest, TrieLayout_Benchmark)
+{
+    Trie wordsTrie{EXTENDED_WORD_LIST};
+
+    std::vector<Board> samples;
+    for (int i = 0; i < 16; ++i)
+    {
+        samples.push_back(createBoggleBoard<32, 32>());
+    }
+    auto hits = profileNodeHits(PackedTrie{wordsTrie}, samples);
+
+    const std::vector<std::pair<std::string, PackedTrie>> layouts{
+        {"Depth-first (insertion)", PackedTrie{wordsTrie, TrieLayout::depthFirst}},
+        {"Breadth-first", PackedTrie{wordsTrie, TrieLayout::breadthFirst}},
+        {"van Emde Boas", PackedTrie{wordsTrie, TrieLayout::vanEmdeBoas}},
+        {"Hot-first (profiled)", PackedTrie{wordsTrie, TrieLayout::hotFirst, &hits}}};
+
+    for (const auto& board : {createBoggleBoard<16, 16>(), createBoggleBoard<32, 32>()})
+    {
+        constexpr int numIterations = 10;
+        std::cout << "\nTrie layouts on " << board.rows << "x" << board.columns
+                  << " board with Extended Word List:\n";
+
+        auto start = Clock::now();
+        for (int i = 0; i < numIterations; ++i)
+        {
+            findValidWordsInBoardRecursive(wordsTrie, board);
+        }
+        std::cout << "  Trie (Recursive): "
+                  << (std::chrono::duration_cast<Duration>(Clock::now() - start) / numIterations)
+                         .count()
+                  << " microseconds\n";
+
+        for (const auto& [layoutName, packedTrie] : layouts)
+        {
+            start = Clock::now();
+            for (int i = 0; i < numIterations; ++i)
+            {
+                findValidWordsInBoardPacked(packedTrie, board);
+            }
+            auto mean = std::chrono::duration_cast<Duration>(Clock::now() - start) / numIterations;
+
+            PackedSolveStats stats;
+            findValidWordsInBoardPacked(packedTrie, board, stats);
+
+            std::cout << "  " << layoutName << ": " << mean.count() << " microseconds, "
+                      << stats.nodeAccesses << " node accesses, " << stats.lineSwitches
+                      << " cache line switches\n";
+        }
+    }
+}
+
+// Benchmark of the expansions and time saved by dead-end memoization on large boards
+TEST_F(BoggleBenchmarkTest, LargeBoards_DeadEndMemo_Benchmark)
+{
+    Trie wordsTrie{EXTENDED_WORD_LIST};
+    const std::vector<Board> boards{createBoggleBoard<16, 16>(), createBoggleBoard<32, 32>(),
+                                    createBoggleBoard<64, 64>()};
+
+    for (const auto& board : boards)
+    {
+        DeadEndStats plain;
+        auto start = Clock::now();
+        auto plainWords = findValidWordsInBoardMemoized(wordsTrie, board, &plain, false);
+        auto plainTime = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        DeadEndStats memo;
+        start = Clock::now();
+        auto memoWords = findValidWordsInBoardMemoized(wordsTrie, board, &memo);
+        auto memoTime = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << "\nDead-end memo on " << board.rows << "x" << board.columns
+                  << " board with Extended Word List:\n"
+                  << "  Expansions without memo: " << plain.expansions << " ("
+                  << plainTime.count() << " microseconds)\n"
+                  << "  Expansions with memo: " << memo.expansions << " (" << memoTime.count()
+                  << " microseconds)\n"
+                  << "  Expansions saved: " << plain.expansions - memo.expansions << "\n"
+                  << "  Dead ends recorded: " << memo.deadEndsRecorded
+                  << ", memo hits: " << memo.memoHits << "\n";
+
+        EXPECT_EQ(memoWords, plainWords);
+    }
+}
+
+// Benchmark mapping where the word-driven solver overtakes the board-driven recursive one
+// Dictionaries are the first N words of the extended word list
+TEST_F(BoggleBenchmarkTest, WordDriven_Crossover_Benchmark)
+{
+    const std::vector<size_t> dictionarySizes{10, 50, 100, 250, 500, 1000};
+    const std::vector<Board> boards{createBoggleBoard<4, 4>(), createBoggleBoard<8, 8>(),
+                                    createBoggleBoard<16, 16>(), createBoggleBoard<32, 32>()};
+
+    std::cout << "\nRecursive / word-driven time ratio (> 1: word-driven is faster):\n"
+              << std::setw(10) << "words";
+    for (const auto& board : boards)
+    {
+        std::cout << std::setw(10) << (std::to_string(board.rows) + "x" + std::to_string(board.columns));
+    }
+    std::cout << "\n";
+
+    for (const auto dictionarySize : dictionarySizes)
+    {
+        std::vector<std::string_view> wordList(EXTENDED_WORD_LIST.begin(),
+                                               EXTENDED_WORD_LIST.begin()
+                                                   + static_cast<std::ptrdiff_t>(dictionarySize));
+        Trie wordsTrie{wordList};
+        auto words = wordsTrie.getWords();
+
+        std::cout << std::setw(10) << dictionarySize;
+        for (const auto& board : boards)
+        {
+            constexpr int numIterations = 5;
+            auto start = Clock::now();
+            for (int i = 0; i < numIterations; ++i)
+            {
+                findValidWordsInBoardRecursive(wordsTrie, board);
+            }
+            auto recursiveTime = static_cast<double>((Clock::now() - start).count());
+
+            start = Clock::now();
+            for (int i = 0; i < numIterations; ++i)
+            {
+                findValidWordsInBoardWordDriven(words, board);
+            }
+            auto wordDrivenTime = static_cast<double>((Clock::now() - start).count());
+
+            std::cout << std::setw(10) << std::fixed << std::setprecision(2)
+                      << recursiveTime / std::max(wordDrivenTime, 1.0);
+        }
+        std::cout << "\n";
+    }
+}
+
+// Benchmark of batch solving small boards in SIMD lanes against the scalar batch path
+TEST_F(BoggleBenchmarkTest, SmallBoards_Batch_Lockstep_Benchmark)
+{
+    runBatchBenchmark<4, 4>("Extended Word List", EXTENDED_WORD_LIST, 2048);
+    runBatchBenchmark<5, 5>("Extended Word List", EXTENDED_WORD_LIST, 2048);
+}
+
+// Benchmark of board generation: random letters against rolled dice, one by one, in bulk and in
+// parallel
+TEST_F(BoggleBenchmarkTest, BoardGeneration_Benchmark)
+{
+    constexpr size_t nBoards = 200000;
+    auto boardsPerSecond = [](Clock::duration duration)
+    {
+        return static_cast<double>(nBoards)
+               / std::max(std::chrono::duration<double>(duration).count(), 1e-9);
+    };
+
+    std::cout << "\nGeneration of " << nBoards << " boards (4x4):\n" << std::fixed
+              << std::setprecision(0);
+
+    auto start = Clock::now();
+    size_t checksum{0};
+    for (size_t i = 0; i < nBoards; ++i)
+    {
+        checksum += static_cast<size_t>(createBoggleBoard<4, 4>().table[0]);
+    }
+    std::cout << "  createBoggleBoard:         " << boardsPerSecond(Clock::now() - start)
+              << " boards/sec\n";
+
+    BoardGenerator generator{DiceSet::classic4x4, 1};
+    start = Clock::now();
+    for (size_t i = 0; i < nBoards; ++i)
+    {
+        checksum += static_cast<size_t>(generator.next().table[0]);
+    }
+    std::cout << "  BoardGenerator::next:      " << boardsPerSecond(Clock::now() - start)
+              << " boards/sec\n";
+
+    std::vector<char> buffer(nBoards * 16);
+    start = Clock::now();
+    generator.generate(buffer, nBoards);
+    std::cout << "  BoardGenerator::generate:  " << boardsPerSecond(Clock::now() - start)
+              << " boards/sec\n";
+
+    const size_t nThreads = std::max(1u, std::thread::hardware_concurrency());
+    start = Clock::now();
+    generateBoardsParallel(DiceSet::classic4x4, 4, 4, 1, buffer, nBoards, nThreads);
+    std::cout << "  generateBoardsParallel (" << nThreads
+              << " threads): " << boardsPerSecond(Clock::now() - start) << " boards/sec\n";
+
+    EXPECT_GT(checksum + static_cast<size_t>(buffer[0]), 0u);
+}
+
+// Profile of the heap allocations of dictionary builds and of every solver engine
+// Only meaningful in an allocation-tracking build (-DBOGGLE_TRACK_ALLOCATIONS=ON)
+TEST_F(BoggleBenchmarkTest, Allocation_Profile_Benchmark)
+{
+    if (!allocationTrackingEnabled)
+    {
+        GTEST_SKIP() << "Allocation tracking is disabled";
+    }
+
+    auto printStats = [](const std::string& name, const AllocationStats& stats)
+    {
+        std::cout << "  " << std::left << std::setw(32) << name << std::right << std::setw(10)
+                  << stats.allocations << " allocations " << std::setw(12) << stats.bytes
+                  << " bytes\n";
+    };
+
+    std::cout << "\nDictionary builds (Extended Word List):\n";
+    AllocationScope trieScope;
+    Trie wordsTrie{EXTENDED_WORD_LIST};
+    printStats("Trie", trieScope.stats());
+
+    AllocationScope tableScope;
+    TrieTable wordsTable{wordsTrie};
+    printStats("TrieTable", tableScope.stats());
+
+    AllocationScope packedScope;
+    PackedTrie packedTrie{wordsTrie};
+    printStats("PackedTrie", packedScope.stats());
+
+    for (const auto& board : {createBoggleBoard<16, 16>(), createBoggleBoard<32, 32>()})
+    {
+        std::cout << "\nSolves of a " << board.rows << "x" << board.columns << " board:\n"
+                  << "  " << std::left << std::setw(16) << "engine" << std::right << std::setw(14)
+                  << "allocs/solve" << std::setw(14) << "bytes/solve" << std::setw(14)
+                  << "allocs/word" << "\n";
+
+        for (const auto& engine : getSolverEngines())
+        {
+            const BoardSolver solve{engine.prepare(wordsTrie)};
+            AllocationScope solveScope;
+            const auto words = solve(board);
+            const AllocationStats stats{solveScope.stats()};
+
+            std::cout << "  " << std::left << std::setw(16) << engine.name << std::right
+                      << std::setw(14) << stats.allocations << std::setw(14) << stats.bytes
+                      << std::setw(14) << std::fixed << std::setprecision(1)
+                      << static_cast<double>(stats.allocations)
+                             / static_cast<double>(std::max<size_t>(words.size(), 1))
+                      << "\n";
+        }
+
+        TallyScratch scratch;
+        tallyValidWordsInBoard(wordsTrie, board, {}, scratch);
+        AllocationScope tallyScope;
+        tallyValidWordsInBoard(wordsTrie, board, {}, scratch);
+        std::cout << "  " << std::left << std::setw(16) << "tally (warm)" << std::right
+                  << std::setw(14) << tallyScope.stats().allocations << std::setw(14)
+                  << tallyScope.stats().bytes << "\n";
+    }
+}
+
+// Benchmark of solving four overlapping word lists with one traversal against one solve per list
+TEST_F(BoggleBenchmarkTest, MultiList_Benchmark)
+{
+    std::vector<std::vector<std::string_view>> wordLists(4);
+    for (size_t i = 0; i < EXTENDED_WORD_LIST.size(); ++i)
+    {
+        const auto word = EXTENDED_WORD_LIST[i];
+        wordLists[0].push_back(word);
+        if (word.size() <= 4)
+        {
+            wordLists[1].push_back(word);
+        }
+        if (i % 3 != 0)
+        {
+            wordLists[2].push_back(word);
+        }
+        if (!word.empty() && word.front() <= 'M')
+        {
+            wordLists[3].push_back(word);
+        }
+    }
+
+    const MultiTrie multiTrie{wordLists};
+    std::vector<PackedTrie> listTries;
+    for (const auto& wordList : wordLists)
+    {
+        listTries.emplace_back(Trie{wordList}, TrieLayout::depthFirst);
+    }
+
+    constexpr int numIterations = 10;
+    std::cout << "\nFour word lists:\n"
+              << std::setw(10) << "board" << std::setw(18) << "per-list (us)" << std::setw(18)
+              << "single DFS (us)" << std::setw(18) << "one list (us)" << "\n";
+
+    for (const auto& board : {createBoggleBoard<16, 16>(), createBoggleBoard<32, 32>()})
+    {
+        auto start = Clock::now();
+        size_t separateWords{0};
+        for (int i = 0; i < numIterations; ++i)
+        {
+            for (const auto& listTrie : listTries)
+            {
+                separateWords += findValidWordsInBoardPacked(listTrie, board).size();
+            }
+        }
+        auto separateTime = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        start = Clock::now();
+        size_t multiWords{0};
+        for (int i = 0; i < numIterations; ++i)
+        {
+            for (const auto& words : findValidWordsInBoardMulti(multiTrie, board))
+            {
+                multiWords += words.size();
+            }
+        }
+        auto multiTime = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        start = Clock::now();
+        for (int i = 0; i < numIterations; ++i)
+        {
+            findValidWordsInBoardPacked(listTries[0], board);
+        }
+        auto singleTime = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << std::setw(6) << board.rows << "x" << std::setw(3) << std::left
+                  << board.columns << std::right << std::setw(18)
+                  << separateTime.count() / numIterations << std::setw(18)
+                  << multiTime.count() / numIterations << std::setw(18)
+                  << singleTime.count() / numIterations << "\n";
+
+        EXPECT_EQ(multiWords, separateWords);
+    }
+}
+
+// Benchmark of deadline-bounded solves: share of the words found within each budget, with
+// promising start cells first and in row-major order, and how late the solve returns
+TEST_F(BoggleBenchmarkTest, Anytime_Deadline_Benchmark)
+{
+    Trie wordsTrie{EXTENDED_WORD_LIST};
+    const AnytimeSolver solver{wordsTrie};
+    const Board board = createBoggleBoard<64, 64>();
+
+    auto fullStart = Clock::now();
+    const size_t nWords = solver.solve(board).words.size();
+    auto fullTime = std::chrono::duration_cast<Duration>(Clock::now() - fullStart);
+
+    std::cout << "\nAnytime solve of a 64x64 board (" << nWords << " words, "
+              << fullTime.count() << " us to completion):\n"
+              << std::setw(12) << "budget (us)" << std::setw(16) << "ranked found" << std::setw(18)
+              << "row-major found" << std::setw(16) << "overshoot (us)" << "\n";
+
+    for (const int budget : {100, 250, 500, 1000, 2000, 5000})
+    {
+        double found[2]{};
+        Duration overshoot{0};
+        for (const bool ranked : {true, false})
+        {
+            SolveOptions options;
+            options.promisingStartsFirst = ranked;
+            auto start = Clock::now();
+            options.deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(budget);
+            const auto result = solver.solve(board, options);
+            auto elapsed = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+            found[ranked ? 0 : 1] = 100.0 * static_cast<double>(result.words.size())
+                                    / static_cast<double>(std::max<size_t>(nWords, 1));
+            if (ranked)
+            {
+                overshoot = std::max(Duration(0), elapsed - Duration(budget));
+            }
+        }
+
+        std::cout << std::setw(12) << budget << std::setw(15) << std::fixed << std::setprecision(1)
+                  << found[0] << "%" << std::setw(17) << found[1] << "%" << std::setw(16)
+                  << overshoot.count() << "\n";
+    }
+}
+
+// Sorted, distinct words of a board: strings sorted and deduplicated after the solve, against word
+// ids listed in order; then the words of a batch of boards, merging sorted string lists against
+// the union of id sets
+TEST_F(BoggleBenchmarkTest, WordIdSet_Benchmark)
+{
+    Trie wordsTrie{EXTENDED_WORD_LIST};
+    const PackedTrie packedTrie{wordsTrie, TrieLayout::depthFirst};
+    const WordIndex dictionary{wordsTrie};
+
+    auto sortedWords = [&packedTrie](const Board& board)
+    {
+        auto words = findValidWordsInBoardPacked(packedTrie, board);
+        std::sort(words.begin(), words.end());
+        words.erase(std::unique(words.begin(), words.end()), words.end());
+        return words;
+    };
+
+    constexpr int numIterations = 10;
+    std::cout << "\nSorted distinct words:\n"
+              << std::setw(10) << "board" << std::setw(22) << "strings + sort (us)"
+              << std::setw(18) << "word ids (us)" << "\n";
+
+    for (const auto& board :
+         {createBoggleBoard<16, 16>(), createBoggleBoard<32, 32>(), createBoggleBoard<64, 64>()})
+    {
+        auto start = Clock::now();
+        size_t stringWords{0};
+        for (int i = 0; i < numIterations; ++i)
+        {
+            stringWords += sortedWords(board).size();
+        }
+        auto stringTime = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        start = Clock::now();
+        size_t idWords{0};
+        for (int i = 0; i < numIterations; ++i)
+        {
+            idWords += findValidWordIdsInBoard(dictionary, board).words().size();
+        }
+        auto idTime = std::chrono::duration_cast<Duration>(Clock::now() - start);
+
+        std::cout << std::setw(6) << board.rows << "x" << std::setw(3) << std::left
+                  << board.columns << std::right << std::setw(22)
+                  << stringTime.count() / numIterations << std::setw(18)
+                  << idTime.count() / numIterations << "\n";
+
+        EXPECT_EQ(idWords, stringWords);
+    }
+
+    // Words found on any of a batch of 16x16 boards
+    std::vector<Board> boards;
+    for (int i = 0; i < 100; ++i)
+    {
+        boards.push_back(createBoggleBoard<16, 16>());
+    }
+    std::vector<std::vector<std::string>> stringResults;
+    std::vector<WordIdSet> idResults;
+    for (const auto& board : boards)
+    {
+        stringResults.push_back(sortedWords(board));
+        idResults.push_back(findValidWordIdsInBoard(dictionary, board));
+    }
+
+    auto start = Clock::now();
+    std::vector<std::string> unionStrings{stringResults.front()};
+    for (size_t i = 1; i < stringResults.size(); ++i)
+    {
+        std::vector<std::string> merged;
+        std::set_union(unionStrings.begin(), unionStrings.end(), stringResults[i].begin(),
+                       stringResults[i].end(), std::back_inserter(merged));
+        unionStrings = std::move(merged);
+    }
+    auto stringTime = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+
+    start = Clock::now();
+    WordIdSet unionIds{idResults.front()};
+    for (size_t i = 1; i < idResults.size(); ++i)
+    {
+        unionIds |= idResults[i];
+    }
+    auto idTime = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start);
+
+    std::cout << "Union of " << boards.size() << " results: strings " << stringTime.count()
+              << " ns, word ids " << idTime.count() << " ns (" << unionIds.size() << " words)\n";
+    EXPECT_EQ(unionIds.toStrings(), unionStrings);
+}
+
+// Per-request allocation: the default allocator against a monotonic arena per thread, released
+// after every request, with threads solving boards (and building dictionaries) concurrently so
+// that contention in malloc shows up
+TEST_F(BoggleBenchmarkTest, MemoryResource_Benchmark)
+{
+    Trie wordsTrie{EXTENDED_WORD_LIST};
+    const PackedTrie packedTrie{wordsTrie};
+    std::vector<Board> boards;
+    for (int i = 0; i < 64; ++i)
+    {
+        boards.push_back(createBoggleBoard<16, 16>());
+    }
+    constexpr size_t boardsPerThread = 256;
+    constexpr size_t triesPerThread = 32;
+
+    // Runs request(thread, index, resource) on nThreads threads; resource is nullptr for the
+    // default allocator, or a thread's arena released after every request
+    auto run = [](size_t nThreads, size_t requests, bool useArena, const auto& request)
+    {
+        const auto start = Clock::now();
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < nThreads; ++t)
+        {
+            threads.emplace_back(
+                [&, t]
+                {
+                    std::vector<std::byte> buffer(useArena ? 1024 * 1024 : 0);
+                    std::pmr::monotonic_buffer_resource arena{buffer.data(), buffer.size()};
+                    for (size_t i = 0; i < requests; ++i)
+                    {
+                        request(t, i, useArena ? &arena : nullptr);
+                        arena.release();
+                    }
+                });
+        }
+        for (auto& thread : threads)
+        {
+            thread.join();
+        }
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    };
+
+    // Words found and nodes built, by allocator and thread
+    std::vector<std::vector<size_t>> counts(2, std::vector<size_t>(8, 0));
+    auto solve = [&](size_t thread, size_t i, std::pmr::memory_resource* resource)
+    {
+        const Board& board = boards[(thread + i) % boards.size()];
+        counts[resource ? 1 : 0][thread] += resource
+                                  ? findValidWordsInBoardPacked(packedTrie, board, resource).size()
+                                  : findValidWordsInBoardPacked(packedTrie, board).size();
+    };
+    auto build = [&](size_t thread, size_t, std::pmr::memory_resource* resource)
+    {
+        const Trie trie{EXTENDED_WORD_LIST,
+                        resource ? resource : std::pmr::get_default_resource()};
+        counts[resource ? 1 : 0][thread] += trie.getNodeCount();
+    };
+
+    std::cout << "\nPer-request allocation (16x16 solves, " << EXTENDED_WORD_LIST.size()
+              << "-word dictionary builds):\n"
+              << std::setw(8) << "threads" << std::setw(20) << "solve default/s" << std::setw(18)
+              << "solve arena/s" << std::setw(20) << "build default/s" << std::setw(18)
+              << "build arena/s" << "\n"
+              << std::fixed << std::setprecision(0);
+    for (const size_t nThreads : {1u, 2u, 4u, 8u})
+    {
+        const double solveDefault = run(nThreads, boardsPerThread, false, solve);
+        const double solveArena = run(nThreads, boardsPerThread, true, solve);
+        const double buildDefault = run(nThreads, triesPerThread, false, build);
+        const double buildArena = run(nThreads, triesPerThread, true, build);
+        const auto perSecond = [nThreads](size_t requests, double seconds)
+        { return static_cast<double>(nThreads * requests) / std::max(seconds, 1e-9); };
+        std::cout << std::setw(8) << nThreads << std::setw(20)
+                  << perSecond(boardsPerThread, solveDefault) << std::setw(18)
+                  << perSecond(boardsPerThread, solveArena) << std::setw(20)
+                  << perSecond(triesPerThread, buildDefault) << std::setw(18)
+                  << perSecond(triesPerThread, buildArena) << "\n";
+    }
+
+    // Both allocators solved the same boards and built the same tries
+    EXPECT_EQ(counts[1], counts[0]);
+}
+
+// Depth-first solves against the level-synchronous engine, with the small word list (whose trie
+// stays in cache) and with a dictionary of random paths of random boards (a trie of about a million
+// nodes with many live paths)
+TEST_F(BoggleBenchmarkTest, LevelSync_Benchmark)
+{
+    const std::vector<std::string> randomWords{randomPathWords(200000, 42)};
+    const Trie smallTrie{EXTENDED_WORD_LIST};
+    const Trie largeTrie{std::vector<std::string_view>(randomWords.begin(), randomWords.end())};
+    constexpr int numIterations = 5;
+
+    std::cout << "\nDepth-first against level-synchronous solves (us per board):\n"
+              << std::setw(10) << "board" << std::setw(12) << "trie nodes" << std::setw(12)
+              << "iterative" << std::setw(12) << "packed" << std::setw(12) << "level-sync"
+              << std::setw(16) << "largest level" << "\n";
+
+    for (const Trie* wordsTrie : {&smallTrie, &largeTrie})
+    {
+        const PackedTrie packedTrie{*wordsTrie, TrieLayout::depthFirst};
+        for (const auto& board : {createBoggleBoard<16, 16>(), createBoggleBoard<32, 32>()})
+        {
+            auto time = [&board](const auto& solve)
+            {
+                size_t nWords{0};
+                const auto start = Clock::now();
+                for (int i = 0; i < numIterations; ++i)
+                {
+                    nWords += solve(board).size();
+                }
+                const auto duration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+                return std::make_pair(duration.count() / numIterations, nWords);
+            };
+
+            const auto iterative = time([wordsTrie](const Board& b)
+                                        { return findValidWordsInBoardIterative(*wordsTrie, b); });
+            const auto packed = time([&packedTrie](const Board& b)
+                                     { return findValidWordsInBoardPacked(packedTrie, b); });
+            const auto levelSync = time([&packedTrie](const Board& b)
+                                        { return findValidWordsInBoardLevelSync(packedTrie, b); });
+            LevelSyncStats stats;
+            findValidWordsInBoardLevelSync(packedTrie, board, stats);
+
+            std::cout << std::setw(6) << board.rows << "x" << std::setw(3) << std::left
+                      << board.columns << std::right << std::setw(12) << wordsTrie->getNodeCount()
+                      << std::setw(12) << iterative.first << std::setw(12) << packed.first
+                      << std::setw(12) << levelSync.first << std::setw(16) << stats.largestLevel
+                      << "\n";
+
+            EXPECT_EQ(levelSync.second, iterative.second);
+            EXPECT_EQ(packed.second, iterative.second);
+        }
+    }
+}
+
+// Dictionary backends behind the BoggleDictionary concept: memory, latency of whole-string lookups
+// (the prefixes of every word, and as many strings which leave the dictionary) and solve time with
+// the templated solver
+TEST_F(BoggleBenchmarkTest, DictionaryBackends_Benchmark)
+{
+    const std::vector<std::string> randomWords{randomPathWords(200000, 7)};
+    const std::vector<std::string_view> smallWords(EXTENDED_WORD_LIST.begin(),
+                                                   EXTENDED_WORD_LIST.end());
+    const std::vector<std::string_view> largeWords(randomWords.begin(), randomWords.end());
+    const Board board{createBoggleBoard<16, 16>()};
+
+    for (const auto* words : {&smallWords, &largeWords})
+    {
+        CountingResource trieMemory;
+        const Trie wordsTrie{*words, &trieMemory};
+        const TrieTable wordsTable{wordsTrie};
+        const PackedTrie packedTrie{wordsTrie, TrieLayout::depthFirst};
+        const PerfectHashDictionary perfectHash{wordsTrie};
+
+        std::vector<std::string> probes;
+        std::mt19937_64 random{3};
+        for (const auto word : *words)
+        {
+            const size_t length{1 + random() % std::max<size_t>(word.size(), 1)};
+            probes.emplace_back(word.substr(0, length));
+            probes.push_back(probes.back() + static_cast<char>('A' + random() % 26));
+        }
+        std::shuffle(probes.begin(), probes.end(), random);
+
+        // About a million lookups, to time more than the first (cold) pass
+        const size_t repeats{std::max<size_t>(1, 1000000 / probes.size())};
+        auto lookupNs = [&probes, repeats](const auto& contains)
+        {
+            size_t found{0};
+            const auto start = Clock::now();
+            for (size_t i = 0; i < repeats; ++i)
+            {
+                for (const auto& probe : probes)
+                {
+                    found += contains(probe) == inTrie::doesntExist ? 0u : 1u;
+                }
+            }
+            const auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start);
+            return std::make_pair(
+                elapsed.count() / static_cast<double>(repeats * probes.size()), found);
+        };
+        auto solveUs = [&board](const auto& dictionary)
+        {
+            const auto start = Clock::now();
+            const auto nWords = findValidWordsInBoardWith(dictionary, board).size();
+            return std::make_pair(
+                std::chrono::duration_cast<Duration>(Clock::now() - start).count(), nWords);
+        };
+
+        struct Row
+        {
+            std::string name;
+            size_t bytes;
+            std::pair<double, size_t> lookup;
+            std::pair<long long, size_t> solve;
+        };
+        const std::vector<Row> rows{
+            {"Trie::contains", trieMemory.bytesInUse,
+             lookupNs([&](const std::string& s) { return wordsTrie.contains(s); }),
+             solveUs(TrieDictionary{wordsTrie})},
+            {"Trie (steps)", trieMemory.bytesInUse,
+             lookupNs([&](const std::string& s)
+                      { return containsWith(TrieDictionary{wordsTrie}, s); }),
+             solveUs(TrieDictionary{wordsTrie})},
+            {"TrieTable", wordsTable.stateCount() * (wordsTable.columnCount() * 4 + 1),
+             lookupNs([&](const std::string& s)
+                      { return containsWith(TrieTableDictionary{wordsTable}, s); }),
+             solveUs(TrieTableDictionary{wordsTable})},
+            {"PackedTrie", packedTrie.nodeCount() * sizeof(PackedTrie::PackedNode),
+             lookupNs([&](const std::string& s)
+                      { return containsWith(PackedTrieDictionary{packedTrie}, s); }),
+             solveUs(PackedTrieDictionary{packedTrie})},
+            {"PerfectHash", perfectHash.memoryBytes(),
+             lookupNs([&](const std::string& s) { return containsWith(perfectHash, s); }),
+             solveUs(perfectHash)}};
+
+        std::cout << "\n" << words->size() << " words, " << wordsTrie.getNodeCount()
+                  << " prefixes:\n"
+                  << "  " << std::left << std::setw(16) << "backend" << std::right
+                  << std::setw(14) << "bytes/prefix" << std::setw(14) << "lookup (ns)"
+                  << std::setw(18) << "16x16 solve (us)" << "\n";
+        for (const auto& row : rows)
+        {
+            std::cout << "  " << std::left << std::setw(16) << row.name << std::right
+                      << std::setw(14) << std::fixed << std::setprecision(1)
+                      << static_cast<double>(row.bytes)
+                             / static_cast<double>(wordsTrie.getNodeCount())
+                      << std::setw(14) << row.lookup.first << std::setw(18) << row.solve.first
+                      << "\n";
+            EXPECT_EQ(row.lookup.second, rows.front().lookup.second);
+            EXPECT_EQ(row.solve.second, rows.front().solve.second);
+        }
+    }
+}
+
+// Row-major against Z-order letter tables (ZOrderBoard) on large boards: recursive, iterative and
+// packed solve times, and
+// the 64-byte cache lines of the letter table holding the 3x3 neighbourhood of a cell (averaged
+// over all cells), which is what a depth-first step reads. For hardware cache-miss counts, run this
+// benchmark under `perf stat -e cache-misses` with --gtest_filter=*BoardLayout*.
+TEST_F(BoggleBenchmarkTest, BoardLayout_Benchmark)
+{
+    const Trie wordsTrie{EXTENDED_WORD_LIST};
+    const PackedTrie packedTrie{wordsTrie, TrieLayout::vanEmdeBoas};
+    constexpr int numIterations = 3;
+
+    // cellIndex gives the index of a cell in the letter table of the layout
+    auto linesPerNeighbourhood = [](size_t rows, size_t columns, const auto& cellIndex)
+    {
+        size_t lines{0};
+        for (size_t r{0}; r < rows; r++)
+        {
+            for (size_t c{0}; c < columns; c++)
+            {
+                std::vector<size_t> touched;
+                for (size_t nextR{r > 0 ? r - 1 : 0}; nextR <= std::min(r + 1, rows - 1); nextR++)
+                {
+                    for (size_t nextC{c > 0 ? c - 1 : 0}; nextC <= std::min(c + 1, columns - 1);
+                         nextC++)
+                    {
+                        touched.push_back(cellIndex(nextR, nextC) / 64);
+                    }
+                }
+                std::sort(touched.begin(), touched.end());
+                lines += static_cast<size_t>(
+                    std::distance(touched.begin(), std::unique(touched.begin(), touched.end())));
+            }
+        }
+        return static_cast<double>(lines) / static_cast<double>(rows * columns);
+    };
+
+    std::cout << "\nRow-major against Z-order boards:\n" << std::setw(10) << "board"
+              << std::setw(10) << "layout" << std::setw(14) << "lines/cell" << std::setw(18)
+              << "recursive (us)" << std::setw(18) << "iterative (us)" << std::setw(16)
+              << "packed (us)" << "\n";
+
+    for (const auto& board : {createBoggleBoard<64, 64>(), createBoggleBoard<256, 256>(),
+                              createBoggleBoard<512, 512>()})
+    {
+        const ZOrderBoard zOrder{board};
+        auto time = [](const auto& solve)
+        {
+            size_t nWords{0};
+            const auto start = Clock::now();
+            for (int i = 0; i < numIterations; ++i)
+            {
+                nWords += solve().size();
+            }
+            const auto duration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+            return std::make_pair(duration.count() / numIterations, nWords);
+        };
+
+        // Times of the recursive, iterative and packed solves of a layout
+        auto timeSolvers = [&](const auto& layout)
+        {
+            return std::array{
+                time([&] { return findValidWordsInBoardRecursive(wordsTrie, layout); }),
+                time([&] { return findValidWordsInBoardIterative(wordsTrie, layout); }),
+                time([&] { return findValidWordsInBoardPacked(packedTrie, layout); })};
+        };
+        const auto rowMajor = timeSolvers(board);
+        const auto zOrdered = timeSolvers(zOrder);
+        auto rowMajorIndex = [&board](size_t r, size_t c) { return r * board.columns + c; };
+        auto zOrderIndex = [&zOrder](size_t r, size_t c) { return zOrder.cellIndex(r, c); };
+
+        auto printRow = [&board](const char* layout, double lines, const auto& times)
+        {
+            std::cout << std::setw(6) << board.rows << "x" << std::setw(3) << std::left
+                      << board.columns << std::right << std::setw(10) << layout << std::setw(14)
+                      << std::fixed << std::setprecision(2) << lines << std::setprecision(0)
+                      << std::setw(18) << static_cast<double>(times[0].first) << std::setw(18)
+                      << static_cast<double>(times[1].first) << std::setw(16)
+                      << static_cast<double>(times[2].first) << "\n";
+        };
+        printRow("row", linesPerNeighbourhood(board.rows, board.columns, rowMajorIndex), rowMajor);
+        printRow("z-order", linesPerNeighbourhood(board.rows, board.columns, zOrderIndex),
+                 zOrdered);
+        for (size_t solver{0}; solver < rowMajor.size(); solver++)
+        {
+            EXPECT_EQ(zOrdered[solver].second, rowMajor[solver].second);
+        }
+    }
+}
+
+// Interleaved depth-first searches: time per board against the number of searches K, with the
+// plain packed solver (a single search) as the baseline, and the best K for every board size
+TEST_F(BoggleBenchmarkTest, Interleaved_Benchmark)
+{
+    const std::vector<std::string> randomWords{randomPathWords(200000, 11)};
+    const Trie smallTrie{EXTENDED_WORD_LIST};
+    const Trie largeTrie{std::vector<std::string_view>(randomWords.begin(), randomWords.end())};
+    const std::vector<size_t> searchCounts{1, 2, 4, 8, 16, 32, 64};
+
+    struct BoardSet
+    {
+        std::string name;
+        std::vector<Board> boards;
+    };
+    std::vector<BoardSet> boardSets;
+    boardSets.push_back({"4x4 (x500)", {}});
+    for (int i = 0; i < 500; ++i)
+    {
+        boardSets.back().boards.push_back(createBoggleBoard<4, 4>());
+    }
+    boardSets.push_back({"16x16 (x20)", std::vector<Board>(20)});
+    std::generate(boardSets.back().boards.begin(), boardSets.back().boards.end(),
+                  createBoggleBoard<16, 16>);
+    boardSets.push_back({"64x64", {createBoggleBoard<64, 64>()}});
+    boardSets.push_back({"256x256", {createBoggleBoard<256, 256>()}});
+
+    for (const Trie* wordsTrie : {&smallTrie, &largeTrie})
+    {
+        const PackedTrie packedTrie{*wordsTrie, TrieLayout::vanEmdeBoas};
+        std::cout << "\nInterleaved searches, " << wordsTrie->getNodeCount()
+                  << " trie nodes (us per board set):\n"
+                  << std::setw(12) << "boards" << std::setw(10) << "packed";
+        for (const size_t nSearches : searchCounts)
+        {
+            std::cout << std::setw(8) << ("K=" + std::to_string(nSearches));
+        }
+        std::cout << std::setw(8) << "best" << "\n";
+
+        for (const auto& [name, boards] : boardSets)
+        {
+            auto time = [&boards](const auto& solve)
+            {
+                size_t nWords{0};
+                const auto start = Clock::now();
+                for (const auto& board : boards)
+                {
+                    nWords += solve(board).size();
+                }
+                const auto duration = std::chrono::duration_cast<Duration>(Clock::now() - start);
+                return std::make_pair(duration.count(), nWords);
+            };
+
+            const auto packed = time([&packedTrie](const Board& board)
+                                     { return findValidWordsInBoardPacked(packedTrie, board); });
+            std::cout << std::setw(12) << name << std::setw(10) << packed.first;
+            size_t bestSearches{0};
+            long long bestTime{packed.first};
+            for (const size_t nSearches : searchCounts)
+            {
+                const auto interleaved = time(
+                    [&packedTrie, nSearches](const Board& board)
+                    { return findValidWordsInBoardInterleaved(packedTrie, board, nSearches); });
+                std::cout << std::setw(8) << interleaved.first;
+                if (interleaved.first < bestTime)
+                {
+                    bestTime = interleaved.first;
+                    bestSearches = nSearches;
+                }
+                EXPECT_EQ(interleaved.second, packed.second);
+            }
+            std::cout << std::setw(8)
+                      << (bestSearches == 0 ? std::string{"packed"}
+                                            : "K=" + std::to_string(bestSearches))
+                      << "\n";
+        }
+    }
+}
+
+// End-to-end throughput of a board file solved into a results file: a sequential loop which reads,
+// solves and writes one board at a time with std::endl, against the streaming pipeline
+TEST_F(BoggleBenchmarkTest, StreamingPipeline_Benchmark)
+{
+    const PackedTrie wordsTrie{Trie{EXTENDED_WORD_LIST}, TrieLayout::vanEmdeBoas};
+    constexpr size_t nBoards{100000};
+    std::string input;
+    BoardGenerator generator{DiceSet::classic4x4, 4, 4, 21};
+    for (size_t i{0}; i < nBoards; i++)
+    {
+        input += formatBoardLine(generator.next()) + "\n";
+    }
+    const auto outputPath
+        = std::filesystem::temp_directory_path() / "boggle_pipeline_benchmark.txt";
+
+    std::istringstream sequentialIn{input};
+    std::ofstream sequentialOut{outputPath};
+    const auto start = Clock::now();
+    uint64_t sequentialWords{0};
+    for (std::string line; std::getline(sequentialIn, line);)
+    {
+        auto words = findValidWordsInBoardPacked(wordsTrie, *parseBoardLine(line));
+        std::sort(words.begin(), words.end());
+        words.erase(std::unique(words.begin(), words.end()), words.end());
+        sequentialWords += words.size();
+        sequentialOut << line << ":";
+        for (const auto& word : words)
+        {
+            sequentialOut << " " << word;
+        }
+        sequentialOut << std::endl;
+    }
+    sequentialOut.close();
+    const double sequentialSeconds{std::chrono::duration<double>(Clock::now() - start).count()};
+
+    std::cout << "\n" << nBoards << " 4x4 boards from memory to a file (boards/s):\n"
+              << "  " << std::left << std::setw(32) << "sequential, std::endl" << std::right
+              << std::setw(12) << std::fixed << std::setprecision(0)
+              << static_cast<double>(nBoards) / sequentialSeconds << "\n";
+
+    const size_t maxSolvers{std::max<size_t>(4, std::thread::hardware_concurrency())};
+    for (size_t solvers{1}; solvers <= maxSolvers; solvers *= 2)
+    {
+        std::istringstream in{input};
+        std::ofstream out{outputPath};
+        const PipelineReport report{
+            runPipeline(wordsTrie, in, out, PipelineConfig{solvers, 256, 16})};
+        std::cout << "  " << std::left << std::setw(32)
+                  << ("pipeline, " + std::to_string(solvers) + " solver threads") << std::right
+                  << std::setw(12) << report.boardsPerSecond() << "\n";
+        EXPECT_EQ(report.boardsSolved, nBoards);
+        EXPECT_EQ(report.wordsFound, sequentialWords);
+    }
+    std::filesystem::remove(outputPath);
+}
+
+// Boards with 1 to 4 blank tiles: the packed solver stepping into every trie child at a blank, in
+// one pass, against solving the board once per assignment of letters to the blanks (26^blanks
+// solves, measured on fewer boards as the blanks grow, and skipped for 4 blanks)
+TEST_F(BoggleBenchmarkTest, Wildcard_Benchmark)
+{
+    const PackedTrie wordsTrie{Trie{EXTENDED_WORD_LIST}, TrieLayout::vanEmdeBoas};
+    BoardGenerator generator{DiceSet::classic4x4, 4, 4, 31};
+    std::vector<Board> boards(200);
+    std::generate(boards.begin(), boards.end(), [&generator] { return generator.next(); });
+    const std::vector<size_t> naiveBoards{200, 40, 4, 1, 0};
+
+    std::cout << "\nBlank tiles on 4x4 boards (us per board):\n"
+              << std::setw(8) << "blanks" << std::setw(12) << "words" << std::setw(12)
+              << "one pass" << std::setw(14) << "26^n solves" << std::setw(10) << "speedup\n";
+    for (size_t nBlanks{0}; nBlanks <= 4; nBlanks++)
+    {
+        // Blanks spread over the board: cells 0, 5, 10 and 15 (the diagonal)
+        std::vector<Board> blankBoards{boards};
+        for (auto& board : blankBoards)
+        {
+            for (size_t blank{0}; blank < nBlanks; blank++)
+            {
+                board.table[blank * 5] = wildcardTile;
+            }
+        }
+
+        std::vector<size_t> distinctWords;
+        auto start = Clock::now();
+        for (const auto& board : blankBoards)
+        {
+            auto words = findValidWordsInBoardPacked(wordsTrie, board);
+            std::sort(words.begin(), words.end());
+            distinctWords.push_back(
+                static_cast<size_t>(std::unique(words.begin(), words.end()) - words.begin()));
+        }
+        const double onePass{
+            static_cast<double>(std::chrono::duration_cast<Duration>(Clock::now() - start).count())
+            / static_cast<double>(blankBoards.size())};
+        std::cout << std::setw(8) << nBlanks << std::setw(12)
+                  << std::accumulate(distinctWords.begin(), distinctWords.end(), size_t{0})
+                         / blankBoards.size()
+                  << std::setw(12) << std::fixed
+                  << std::setprecision(1) << onePass;
+
+        if (naiveBoards[nBlanks] == 0)
+        {
+            std::cout << std::setw(14) << "-" << std::setw(10) << "-" << "\n";
+            continue;
+        }
+        size_t nAssignments{1};
+        for (size_t blank{0}; blank < nBlanks; blank++)
+        {
+            nAssignments *= 26;
+        }
+        start = Clock::now();
+        for (size_t i{0}; i < naiveBoards[nBlanks]; i++)
+        {
+            std::vector<std::string> words;
+            for (size_t assignment{0}; assignment < nAssignments; assignment++)
+            {
+                Board filled{blankBoards[i]};
+                for (size_t blank{0}, rest{assignment}; blank < nBlanks; blank++, rest /= 26)
+                {
+                    filled.table[blank * 5] = static_cast<char>('A' + rest % 26);
+                }
+                auto filledWords = findValidWordsInBoardPacked(wordsTrie, filled);
+                words.insert(words.end(), filledWords.begin(), filledWords.end());
+            }
+            std::sort(words.begin(), words.end());
+            words.erase(std::unique(words.begin(), words.end()), words.end());
+            EXPECT_EQ(words.size(), distinctWords[i]);
+        }
+        const double naive{
+            static_cast<double>(std::chrono::duration_cast<Duration>(Clock::now() - start).count())
+            / static_cast<double>(naiveBoards[nBlanks])};
+        std::cout << std::setw(14) << naive << std::setw(9) << naive / onePass << "x\n";
+    }
+}
+
+// Interactive queries on a solved board: a SolutionIndex against scanning the paths of the solve
+// for every query (ns per query, averaged over queries of every cell and of every word found)
+TEST_F(BoggleBenchmarkTest, SolutionIndex_Benchmark)
+{
+    const Trie wordsTrie{EXTENDED_WORD_LIST};
+    std::cout << "\nSolution index queries (ns per query):\n"
+              << std::setw(8) << "board" << std::setw(8) << "paths" << std::setw(10) << "build us"
+              << std::setw(11) << "index KB" << std::setw(11) << "paths KB" << std::setw(20)
+              << "cell: index/scan" << std::setw(20) << "word: index/scan" << std::setw(20)
+              << "prefix: index/scan" << std::setw(12) << "path check\n";
+    for (const auto& board : {createBoggleBoard<4, 4>(), createBoggleBoard<16, 16>(),
+                              createBoggleBoard<64, 64>()})
+    {
+        const auto wordPaths = findWordPathsInBoard(wordsTrie, board);
+        auto start = Clock::now();
+        const SolutionIndex index{board, wordPaths};
+        const auto buildTime = std::chrono::duration_cast<Duration>(Clock::now() - start).count();
+        size_t pathBytes{wordPaths.capacity() * sizeof(WordPath)};
+        std::vector<std::string> words;
+        for (const auto& wordPath : wordPaths)
+        {
+            pathBytes += wordPath.cells.capacity() * sizeof(size_t);
+            words.push_back(wordPath.word);
+        }
+        std::sort(words.begin(), words.end());
+        words.erase(std::unique(words.begin(), words.end()), words.end());
+
+        // Function to time queries over items, returning ns per query
+        size_t checksum{0};
+        auto time = [&checksum](size_t count, const auto& query)
+        {
+            const auto begin = Clock::now();
+            for (size_t i{0}; i < count; i++)
+            {
+                checksum += query(i);
+            }
+            return static_cast<double>(
+                       std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - begin)
+                           .count())
+                   / static_cast<double>(std::max<size_t>(count, 1));
+        };
+        const size_t nCells{index.cellCount()};
+
+        const double cellIndex{
+            time(nCells, [&index](size_t cell) { return index.wordsThroughCell(cell).size(); })};
+        const double cellScan{time(nCells,
+                                   [&wordPaths](size_t cell)
+                                   {
+                                       std::vector<std::string_view> found;
+                                       for (const auto& wordPath : wordPaths)
+                                       {
+                                           if (std::find(wordPath.cells.begin(),
+                                                         wordPath.cells.end(), cell)
+                                               != wordPath.cells.end())
+                                           {
+                                               found.push_back(wordPath.word);
+                                           }
+                                       }
+                                       std::sort(found.begin(), found.end());
+                                       return static_cast<size_t>(
+                                           std::unique(found.begin(), found.end()) - found.begin());
+                                   })};
+        const double wordIndex{time(words.size(), [&index, &words](size_t i)
+                                    { return index.path(index.find(words[i])).size(); })};
+        const double wordScan{time(words.size(),
+                                   [&wordPaths, &words](size_t i)
+                                   {
+                                       return std::find_if(wordPaths.begin(), wordPaths.end(),
+                                                           [&words, i](const WordPath& wordPath)
+                                                           { return wordPath.word == words[i]; })
+                                           ->cells.size();
+                                   })};
+        // Prefixes: the first two letters of every word
+        const double prefixIndex{time(words.size(),
+                                      [&index, &words](size_t i)
+                                      {
+                                          return index.wordsWithPrefix(words[i].substr(0, 2))
+                                              .size();
+                                      })};
+        const double prefixScan{
+            time(words.size(),
+                 [&wordPaths, &words](size_t i)
+                 {
+                     const std::string_view prefix{std::string_view(words[i]).substr(0, 2)};
+                     std::vector<std::string_view> found;
+                     for (const auto& wordPath : wordPaths)
+                     {
+                         if (std::string_view(wordPath.word).starts_with(prefix))
+                         {
+                             found.push_back(wordPath.word);
+                         }
+                     }
+                     std::sort(found.begin(), found.end());
+                     return static_cast<size_t>(std::unique(found.begin(), found.end())
+                                                - found.begin());
+                 })};
+        const double pathCheck{time(index.wordCount(),
+                                    [&index](size_t id)
+                                    {
+                                        const uint32_t word{index.findPathWord(
+                                            index.path(static_cast<uint32_t>(id)))};
+                                        return static_cast<size_t>(word);
+                                    })};
+
+        const std::string size{std::to_string(board.rows) + "x" + std::to_string(board.columns)};
+        std::cout << std::setw(8) << size << std::setw(8) << wordPaths.size() << std::setw(10)
+                  << buildTime << std::setw(11) << index.memoryBytes() / 1024 << std::setw(11)
+                  << pathBytes / 1024 << std::fixed << std::setprecision(0) << std::setw(11)
+                  << cellIndex << " / " << std::setw(6) << cellScan << std::setw(11) << wordIndex
+                  << " / " << std::setw(6) << wordScan << std::setw(11) << prefixIndex << " / "
+                  << std::setw(6) << prefixScan << std::setw(12) << pathCheck << "\n";
+        EXPECT_EQ(checksum == 0, wordPaths.empty());
+    }
+}
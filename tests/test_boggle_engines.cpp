@@ -0,0 +1,890 @@
+#include "Board.h"
+#include "LetterIndex.h"
+#include "MultiTrie.h"
+#include "PackedTrie.h"
+#include "PerfectHashDictionary.h"
+#include "Trie.h"
+#include "TrieTable.h"
+#include "WordIdSet.h"
+#include "WordIndex.h"
+#include "ZOrderBoard.h"
+#include "allocation_tracker.h"
+#include "boggle_algorithm.h"
+#include "boggle_anytime.h"
+#include "boggle_counters.h"
+#include "boggle_dictionary.h"
+#include "boggle_engines.h"
+#include "boggle_interleaved.h"
+#include "boggle_level_sync.h"
+#include "boggle_lockstep.h"
+#include "boggle_memo.h"
+#include "boggle_multi.h"
+#include "boggle_packed.h"
+#include "boggle_word_driven.h"
+#include "boggle_word_ids.h"
+#include "create_boggle_board.h"
+#include "word_list.h"
+
+#include <algorithm>
+#include <bit>
+#include <gtest/gtest.h>
+#include <memory_resource>
+#include <set>
+#include <string>
+#include <vector>
+
+// Tests of the alternative solver engines against the reference (recursive/iterative) solvers
+class BoggleEnginesTest : public ::testing::Test
+{
+protected:
+    BoggleEnginesTest() : wordsTrie{EXTENDED_WORD_LIST}
+    {
+    }
+
+    static std::vector<std::string> sorted(std::vector<std::string> words)
+    {
+        std::sort(words.begin(), words.end());
+        return words;
+    }
+
+    template <size_t Rows, size_t Columns>
+    static std::vector<Board> createBoards(size_t count)
+    {
+        std::vector<Board> boards;
+        for (size_t i{0}; i < count; i++)
+        {
+            boards.push_back(createBoggleBoard<Rows, Columns>());
+        }
+        return boards;
+    }
+
+    Trie wordsTrie;
+};
+
+TEST_F(BoggleEnginesTest, TrieTableMatchesTrie)
+{
+    TrieTable wordsTable{wordsTrie};
+
+    for (const auto word : EXTENDED_WORD_LIST)
+    {
+        uint32_t state{TrieTable::rootState};
+        for (const char letter : word)
+        {
+            state = wordsTable.step(state, letter);
+            ASSERT_NE(state, TrieTable::deadState) << word;
+        }
+        EXPECT_TRUE(wordsTable.isWord(state)) << word;
+    }
+
+    EXPECT_EQ(wordsTable.step(wordsTable.step(TrieTable::rootState, 'Q'), 'X'),
+              TrieTable::deadState);
+}
+
+TEST_F(BoggleEnginesTest, LockstepMatchesIterative)
+{
+    TrieTable wordsTable{wordsTrie};
+
+    // Batch sizes which are not a multiple of the lane count leave unused lanes
+    auto boards4 = createBoards<4, 4>(37);
+    auto boards5 = createBoards<5, 5>(21);
+
+    for (const size_t lanes : {8u, 16u, 32u})
+    {
+        for (const auto* boards : {&boards4, &boards5})
+        {
+            auto lockstep = findValidWordsInBoardsLockstep(wordsTable, *boards, lanes);
+            auto iterative = findValidWordsInBoardsIterative(wordsTrie, *boards);
+
+            ASSERT_EQ(lockstep.size(), boards->size());
+            for (size_t i{0}; i < boards->size(); i++)
+            {
+                EXPECT_EQ(lockstep[i], iterative[i]) << "board " << i << ", " << lanes << " lanes";
+            }
+        }
+    }
+}
+
+TEST_F(BoggleEnginesTest, LockstepRejectsMixedSizes)
+{
+    TrieTable wordsTable{wordsTrie};
+    std::vector<Board> boards{createBoggleBoard<4, 4>(), createBoggleBoard<5, 5>()};
+
+    EXPECT_THROW(findValidWordsInBoardsLockstep(wordsTable, boards), std::invalid_argument);
+    EXPECT_THROW(findValidWordsInBoardsLockstep(wordsTable, {createBoggleBoard<9, 9>()}),
+                 std::invalid_argument);
+    EXPECT_THROW(findValidWordsInBoardsLockstep(wordsTable, {boards[0]}, 12),
+                 std::invalid_argument);
+}
+
+TEST_F(BoggleEnginesTest, TallyCountsAndScoresDistinctWords)
+{
+    for (int i{0}; i < 20; i++)
+    {
+        Board board = createBoggleBoard<8, 8>();
+
+        auto words = sorted(findValidWordsInBoardRecursive(wordsTrie, board));
+        words.erase(std::unique(words.begin(), words.end()), words.end());
+
+        size_t expectedScore{0};
+        for (const auto& word : words)
+        {
+            expectedScore += scoreWordLength(word.size());
+        }
+
+        auto tally = tallyValidWordsInBoard(wordsTrie, board);
+        EXPECT_EQ(tally.wordCount, words.size());
+        EXPECT_EQ(tally.score, expectedScore);
+        EXPECT_FALSE(tally.thresholdReached);
+
+        EXPECT_EQ(countValidWordsInBoard(wordsTrie, board), words.size());
+        EXPECT_EQ(scoreValidWordsInBoard(wordsTrie, board), expectedScore);
+    }
+}
+
+TEST_F(BoggleEnginesTest, TallyStopsAtThreshold)
+{
+    Board board = createBoggleBoard<16, 16>();
+    TallyScratch scratch;
+    auto full = tallyValidWordsInBoard(wordsTrie, board, {}, scratch);
+    ASSERT_GT(full.wordCount, 10u);
+
+    auto byWords = tallyValidWordsInBoard(wordsTrie, board, {10, 0}, scratch);
+    EXPECT_TRUE(byWords.thresholdReached);
+    EXPECT_EQ(byWords.wordCount, 10u);
+
+    auto byScore = tallyValidWordsInBoard(wordsTrie, board, {0, 5}, scratch);
+    EXPECT_TRUE(byScore.thresholdReached);
+    EXPECT_GE(byScore.score, 5u);
+    EXPECT_LT(byScore.score, 5u + scoreWordLength(16));
+
+    EXPECT_TRUE(boardReachesThreshold(wordsTrie, board, {full.wordCount, 0}));
+    EXPECT_FALSE(boardReachesThreshold(wordsTrie, board, {full.wordCount + 1, 0}));
+    EXPECT_FALSE(boardReachesThreshold(wordsTrie, board, {0, full.score + 1}));
+}
+
+TEST(ScoreTest, StandardBoggleScoring)
+{
+    EXPECT_EQ(scoreWordLength(2), 0u);
+    EXPECT_EQ(scoreWordLength(3), 1u);
+    EXPECT_EQ(scoreWordLength(4), 1u);
+    EXPECT_EQ(scoreWordLength(5), 2u);
+    EXPECT_EQ(scoreWordLength(6), 3u);
+    EXPECT_EQ(scoreWordLength(7), 5u);
+    EXPECT_EQ(scoreWordLength(8), 11u);
+    EXPECT_EQ(scoreWordLength(12), 11u);
+}
+
+TEST_F(BoggleEnginesTest, LetterIndexListsEveryCell)
+{
+    Board board = createBoggleBoard<8, 8>();
+    LetterIndex letterIndex{board};
+
+    size_t total{0};
+    for (char letter{'A'}; letter <= 'Z'; letter++)
+    {
+        EXPECT_EQ(letterIndex.positionsOf(letter).size(), letterIndex.countOf(letter));
+        for (const auto cell : letterIndex.positionsOf(letter))
+        {
+            EXPECT_EQ(board.table[cell], letter);
+        }
+        total += letterIndex.countOf(letter);
+    }
+    EXPECT_EQ(total, board.table.size());
+}
+
+TEST_F(BoggleEnginesTest, WordDrivenMatchesRecursiveWordSet)
+{
+    Trie smallTrie{WORD_LIST};
+    std::vector<Board> boards{createBoggleBoard<4, 4>(), createBoggleBoard<8, 8>(),
+                              createBoggleBoard<16, 16>(), createBoggleBoard<32, 32>()};
+
+    for (const auto& board : boards)
+    {
+        for (const Trie* trie : {&wordsTrie, &smallTrie})
+        {
+            auto expected = sorted(findValidWordsInBoardRecursive(*trie, board));
+            expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+            EXPECT_EQ(sorted(findValidWordsInBoardWordDriven(*trie, board)), expected)
+                << board.rows << "x" << board.columns;
+        }
+    }
+}
+
+TEST_F(BoggleEnginesTest, WordDrivenHandlesRepeatedLetters)
+{
+    // The path of "ABBA" must not reuse cells, while the anchor is in the middle of the word
+    Board board;
+    board.rows = 2;
+    board.columns = 2;
+    board.table = {'A', 'B', 'Z', 'A'};
+
+    std::vector<std::string> words{"ABA", "ABBA", "BAZA", "AZAB", "ZZ"};
+    EXPECT_EQ(findValidWordsInBoardWordDriven(words, board),
+              (std::vector<std::string>{"ABA", "BAZA", "AZAB"}));
+}
+
+TEST_F(BoggleEnginesTest, MemoizedMatchesRecursive)
+{
+    std::vector<Board> boards{createBoggleBoard<4, 4>(), createBoggleBoard<8, 8>(),
+                              createBoggleBoard<16, 16>(), createBoggleBoard<32, 32>()};
+
+    for (const auto& board : boards)
+    {
+        DeadEndStats withMemo;
+        DeadEndStats withoutMemo;
+        auto expected = findValidWordsInBoardRecursive(wordsTrie, board);
+
+        EXPECT_EQ(findValidWordsInBoardMemoized(wordsTrie, board, &withMemo), expected);
+        EXPECT_EQ(findValidWordsInBoardMemoized(wordsTrie, board, &withoutMemo, false), expected);
+
+        EXPECT_LE(withMemo.expansions, withoutMemo.expansions);
+        EXPECT_EQ(withoutMemo.memoHits, 0u);
+    }
+}
+
+TEST_F(BoggleEnginesTest, MemoizedSkipsRepeatedDeadEnds)
+{
+    // "QZ" is a dead end from every Q; "QZA" is only blocked by cells of its own path
+    Trie trie{std::vector<std::string_view>{"QZZA", "ZQ"}};
+    Board board;
+    board.rows = 2;
+    board.columns = 3;
+    board.table = {'Q', 'Z', 'Q', 'Z', 'Q', 'Z'};
+
+    DeadEndStats stats;
+    EXPECT_EQ(findValidWordsInBoardMemoized(trie, board, &stats),
+              findValidWordsInBoardRecursive(trie, board));
+    EXPECT_GT(stats.deadEndsRecorded, 0u);
+    EXPECT_GT(stats.memoHits, 0u);
+}
+
+TEST_F(BoggleEnginesTest, PackedTrieLayoutsMatchRecursive)
+{
+    std::vector<Board> samples{createBoggleBoard<8, 8>(), createBoggleBoard<8, 8>()};
+    auto hits = profileNodeHits(PackedTrie{wordsTrie}, samples);
+
+    std::vector<PackedTrie> layouts{PackedTrie{wordsTrie, TrieLayout::depthFirst},
+                                    PackedTrie{wordsTrie, TrieLayout::breadthFirst},
+                                    PackedTrie{wordsTrie, TrieLayout::vanEmdeBoas},
+                                    PackedTrie{wordsTrie, TrieLayout::hotFirst, &hits},
+                                    PackedTrie{wordsTrie, TrieLayout::vanEmdeBoas, &hits}};
+
+    for (int i{0}; i < 5; i++)
+    {
+        Board board = createBoggleBoard<16, 16>();
+        auto expected = sorted(findValidWordsInBoardRecursive(wordsTrie, board));
+
+        for (const auto& packedTrie : layouts)
+        {
+            EXPECT_EQ(packedTrie.nodeCount(), wordsTrie.getNodeCount());
+            EXPECT_EQ(sorted(findValidWordsInBoardPacked(packedTrie, board)), expected);
+        }
+    }
+
+    // Without a profile, sibling order is that of the Trie, so the word order is too
+    Board board = createBoggleBoard<16, 16>();
+    EXPECT_EQ(findValidWordsInBoardPacked(layouts[1], board),
+              findValidWordsInBoardRecursive(wordsTrie, board));
+}
+
+TEST_F(BoggleEnginesTest, PackedTrieOrdersSiblingsByHits)
+{
+    std::vector<Board> samples{createBoggleBoard<16, 16>()};
+    auto hits = profileNodeHits(PackedTrie{wordsTrie}, samples);
+    PackedTrie hotTrie{wordsTrie, TrieLayout::hotFirst, &hits};
+
+    const auto& nodes = hotTrie.nodes();
+    for (uint32_t node{0}; node < nodes.size(); node++)
+    {
+        for (uint32_t i{1}; i < nodes[node].childCount; i++)
+        {
+            const uint32_t child{nodes[node].firstChild + i};
+            EXPECT_GE(hits[hotTrie.trieNodeId(child - 1)], hits[hotTrie.trieNodeId(child)]);
+        }
+    }
+
+    EXPECT_THROW(PackedTrie(wordsTrie, TrieLayout::hotFirst), std::invalid_argument);
+}
+
+TEST_F(BoggleEnginesTest, InterleavedMatchesPacked)
+{
+    const Trie longTrie{
+        std::vector<std::string_view>{"ABCDEFGHIJKLMNOP", "ABCDEFGHIJ", "A", "BA", "QQ"}};
+    for (const Trie* trie : {static_cast<const Trie*>(&wordsTrie), &longTrie})
+    {
+        const PackedTrie packedTrie{*trie, TrieLayout::vanEmdeBoas};
+        for (const auto& board : {createBoggleBoard<1, 1>(), createBoggleBoard<2, 2>(),
+                                  createBoggleBoard<4, 4>(), createBoggleBoard<7, 3>(),
+                                  createBoggleBoard<16, 16>()})
+        {
+            const auto expected = findValidWordsInBoardPacked(packedTrie, board);
+            for (const size_t nSearches : {1u, 2u, 3u, 8u, 64u})
+            {
+                EXPECT_EQ(findValidWordsInBoardInterleaved(packedTrie, board, nSearches), expected)
+                    << board.rows << "x" << board.columns << " with " << nSearches;
+            }
+        }
+    }
+
+    // A path through every cell of a 4x4 board
+    Board snake;
+    snake.rows = 4;
+    snake.columns = 4;
+    snake.table = {'A', 'B', 'C', 'D', 'H', 'G', 'F', 'E', 'I', 'J', 'K', 'L', 'P', 'O', 'N', 'M'};
+    const PackedTrie packedTrie{longTrie, TrieLayout::depthFirst};
+    EXPECT_EQ(findValidWordsInBoardInterleaved(packedTrie, snake, 4),
+              (std::vector<std::string>{"A", "ABCDEFGHIJ", "ABCDEFGHIJKLMNOP", "BA"}));
+    EXPECT_TRUE(findValidWordsInBoardInterleaved(packedTrie, Board{}).empty());
+    EXPECT_THROW(findValidWordsInBoardInterleaved(packedTrie, snake, 0), std::invalid_argument);
+    EXPECT_THROW(findValidWordsInBoardInterleaved(packedTrie, snake, 65), std::invalid_argument);
+}
+
+TEST_F(BoggleEnginesTest, LevelSyncMatchesIterative)
+{
+    const PackedTrie packedTrie{wordsTrie, TrieLayout::depthFirst};
+    std::vector<Board> boards{createBoggleBoard<4, 4>(), createBoggleBoard<5, 7>(),
+                              createBoggleBoard<1, 20>(), createBoggleBoard<16, 16>(),
+                              createBoggleBoard<32, 32>()};
+
+    for (const auto& board : boards)
+    {
+        EXPECT_EQ(sorted(findValidWordsInBoardLevelSync(packedTrie, board)),
+                  sorted(findValidWordsInBoardIterative(wordsTrie, board)));
+    }
+
+    // Words come out by length
+    const auto words = findValidWordsInBoardLevelSync(packedTrie, boards[3]);
+    EXPECT_TRUE(std::is_sorted(words.begin(), words.end(),
+                               [](const std::string& left, const std::string& right)
+                               { return left.size() < right.size(); }));
+}
+
+TEST_F(BoggleEnginesTest, LevelSyncConfirmsMaskHitsOnLongPaths)
+{
+    // Past 8 cells, cells 8 columns apart share a mask bit: L is 8 columns from D, and the path of
+    // the longer word would reuse K
+    const Trie longWords{std::vector<std::string_view>{"ABCDEFGHIJKL", "ABCDEFGHIJKLK", "LKJ"}};
+    const PackedTrie packedTrie{longWords};
+    Board board;
+    board.rows = 1;
+    board.columns = 12;
+    board.table = {'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L'};
+
+    LevelSyncStats stats;
+    const auto words = findValidWordsInBoardLevelSync(packedTrie, board, stats);
+    EXPECT_EQ(sorted(words), sorted(findValidWordsInBoardIterative(longWords, board)));
+    EXPECT_EQ(sorted(words), (std::vector<std::string>{"ABCDEFGHIJKL", "LKJ"}));
+    EXPECT_GT(stats.pathWalks, 0u);
+    EXPECT_EQ(stats.levels, 13u);
+    EXPECT_EQ(stats.paths, 15u); // A, L and their extensions along the row
+    EXPECT_EQ(stats.largestLevel, 2u);
+}
+
+TEST_F(BoggleEnginesTest, SolveCountersMatchResults)
+{
+    const Board board = createBoggleBoard<8, 8>();
+
+    using Solve = std::vector<std::string> (*)(const Trie&, const Board&);
+    for (const Solve solve : std::initializer_list<Solve>{findValidWordsInBoardRecursive,
+                                                          findValidWordsInBoardIterative})
+    {
+        resetSolveCounters();
+        const auto words = solve(wordsTrie, board);
+        const SolveCounters counters{threadSolveCounters()};
+
+        if constexpr (solveCountersEnabled)
+        {
+            EXPECT_EQ(counters.wordsEmitted, words.size());
+            EXPECT_EQ(counters.duplicates, countDuplicateWords(words));
+            EXPECT_GE(counters.cellsExpanded, words.size());
+            EXPECT_GT(counters.trieSteps, counters.cellsExpanded);
+            for (const auto& word : words)
+            {
+                EXPECT_GE(counters.maxDepth, word.size());
+            }
+        }
+        else
+        {
+            EXPECT_EQ(counters.cellsExpanded + counters.trieSteps + counters.prefixRejections
+                          + counters.wordsEmitted + counters.duplicates + counters.maxDepth,
+                      0u);
+        }
+    }
+}
+
+TEST_F(BoggleEnginesTest, MultiListSolveMatchesSeparateSolves)
+{
+    // Overlapping lists: all words, short words, every other word, and a list of one word
+    std::vector<std::vector<std::string_view>> wordLists(4);
+    for (size_t i{0}; i < EXTENDED_WORD_LIST.size(); i++)
+    {
+        const auto word = EXTENDED_WORD_LIST[i];
+        wordLists[0].push_back(word);
+        if (word.size() <= 4)
+        {
+            wordLists[1].push_back(word);
+        }
+        if (i % 2 == 0)
+        {
+            wordLists[2].push_back(word);
+        }
+    }
+    wordLists[3].push_back(EXTENDED_WORD_LIST.front());
+
+    const MultiTrie multiTrie{wordLists};
+    ASSERT_EQ(multiTrie.listCount(), 4u);
+
+    for (const auto& board : createBoards<8, 8>(5))
+    {
+        const auto wordsByList = findValidWordsInBoardMulti(multiTrie, board);
+        ASSERT_EQ(wordsByList.size(), 4u);
+        for (size_t list{0}; list < wordLists.size(); list++)
+        {
+            const Trie listTrie{wordLists[list]};
+            EXPECT_EQ(wordsByList[list], findValidWordsInBoardRecursive(listTrie, board))
+                << "list " << list;
+        }
+
+        // Only the requested lists are solved
+        const auto shortWordsOnly = findValidWordsInBoardMulti(multiTrie, board, 0b10);
+        EXPECT_EQ(shortWordsOnly[1], wordsByList[1]);
+        EXPECT_TRUE(shortWordsOnly[0].empty());
+        EXPECT_TRUE(shortWordsOnly[2].empty());
+    }
+
+    std::vector<std::vector<std::string_view>> tooManyLists(65, {"A"});
+    EXPECT_THROW(MultiTrie{tooManyLists}, std::invalid_argument);
+}
+
+TEST_F(BoggleEnginesTest, MultiTrieMasks)
+{
+    const MultiTrie multiTrie{{{"TEA", "TEN"}, {"TEN"}, {"TO"}}};
+    const PackedTrie& trie = multiTrie.trie();
+
+    const uint32_t t{trie.findChild(PackedTrie::rootIndex, 'T')};
+    const uint32_t te{trie.findChild(t, 'E')};
+    const uint32_t ten{trie.findChild(te, 'N')};
+    const uint32_t to{trie.findChild(t, 'O')};
+
+    EXPECT_EQ(multiTrie.wordMask(t), 0u);
+    EXPECT_EQ(multiTrie.subtreeMask(t), 0b111u);
+    EXPECT_EQ(multiTrie.subtreeMask(te), 0b011u);
+    EXPECT_EQ(multiTrie.wordMask(ten), 0b011u);
+    EXPECT_EQ(multiTrie.wordMask(to), 0b100u);
+}
+
+TEST_F(BoggleEnginesTest, AnytimeSolveWithoutLimitsIsComplete)
+{
+    const AnytimeSolver solver{wordsTrie};
+
+    for (const auto& board : createBoards<16, 16>(3))
+    {
+        const auto result = solver.solve(board);
+        auto expected = sorted(findValidWordsInBoardRecursive(wordsTrie, board));
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+        EXPECT_TRUE(result.complete);
+        EXPECT_EQ(sorted(result.words), expected);
+        EXPECT_EQ(result.startCellsSearched, solver.rankStartCells(board).size());
+    }
+}
+
+TEST_F(BoggleEnginesTest, AnytimeSolveStopsAtDeadlineAndStopRequest)
+{
+    const AnytimeSolver solver{wordsTrie};
+    const Board board = createBoggleBoard<32, 32>();
+    const auto allWords = sorted(solver.solve(board).words);
+
+    SolveOptions expired;
+    expired.deadline = std::chrono::steady_clock::now();
+    const auto expiredResult = solver.solve(board, expired);
+    EXPECT_FALSE(expiredResult.complete);
+    EXPECT_TRUE(expiredResult.words.empty());
+
+    std::stop_source stopSource;
+    stopSource.request_stop();
+    SolveOptions stopped;
+    stopped.stopToken = stopSource.get_token();
+    EXPECT_FALSE(solver.solve(board, stopped).complete);
+
+    // Partial results are valid words of the board
+    SolveOptions budget;
+    budget.checkInterval = 1;
+    budget.deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(200);
+    const auto partial = solver.solve(board, budget);
+    for (const auto& word : partial.words)
+    {
+        EXPECT_TRUE(std::binary_search(allWords.begin(), allWords.end(), word)) << word;
+    }
+}
+
+TEST_F(BoggleEnginesTest, AnytimeStartCellsRankedByReachableWords)
+{
+    const AnytimeSolver solver{wordsTrie};
+    const Board board = createBoggleBoard<8, 8>();
+
+    // Words reachable through the two-letter prefixes starting at cell
+    auto reachableWords = [&](size_t cell)
+    {
+        const int r{static_cast<int>(cell / board.columns)};
+        const int c{static_cast<int>(cell % board.columns)};
+        const Node* start = wordsTrie.getRoot().findChild(board.table[cell]);
+        uint32_t count{0};
+        for (int nextR{r - 1}; nextR <= r + 1; nextR++)
+        {
+            for (int nextC{c - 1}; nextC <= c + 1; nextC++)
+            {
+                if (nextR < 0 || nextC < 0 || nextR >= 8 || nextC >= 8
+                    || (nextR == r && nextC == c))
+                {
+                    continue;
+                }
+                const Node* second = start->findChild(board.getLetter(static_cast<size_t>(nextR),
+                                                                      static_cast<size_t>(nextC)));
+                count += second ? solver.wordsBelow(*second) : 0;
+            }
+        }
+        return count;
+    };
+
+    const auto ranked = solver.rankStartCells(board);
+    const auto rowMajor = solver.rankStartCells(board, false);
+    EXPECT_TRUE(std::is_sorted(rowMajor.begin(), rowMajor.end()));
+    EXPECT_TRUE(std::is_permutation(ranked.begin(), ranked.end(), rowMajor.begin()));
+    // Ranked by the bit width of the count, ties in row-major order
+    for (size_t i{1}; i < ranked.size(); i++)
+    {
+        const auto previousWidth{std::bit_width(reachableWords(ranked[i - 1]))};
+        const auto width{std::bit_width(reachableWords(ranked[i]))};
+        EXPECT_GE(previousWidth, width);
+        if (previousWidth == width)
+        {
+            EXPECT_LT(ranked[i - 1], ranked[i]);
+        }
+    }
+}
+
+TEST_F(BoggleEnginesTest, WordIndexIdsAreLexicographic)
+{
+    const WordIndex dictionary{wordsTrie};
+    std::vector<std::string> expected{wordsTrie.getWords()};
+    std::sort(expected.begin(), expected.end());
+
+    ASSERT_EQ(dictionary.wordCount(), expected.size());
+    for (uint32_t id{0}; id < expected.size(); id++)
+    {
+        EXPECT_EQ(dictionary.word(id), expected[id]);
+        EXPECT_EQ(dictionary.find(expected[id]), id);
+    }
+    EXPECT_EQ(dictionary.find("QXZ"), WordIndex::noWord);
+}
+
+TEST_F(BoggleEnginesTest, WordIdSolveMatchesRecursiveWordSet)
+{
+    const WordIndex dictionary{wordsTrie};
+    std::vector<Board> boards{createBoggleBoard<4, 4>(), createBoggleBoard<16, 16>(),
+                              createBoggleBoard<32, 32>()};
+
+    WordIdSet allBoards{dictionary};
+    for (const auto& board : boards)
+    {
+        auto expected = sorted(findValidWordsInBoardRecursive(wordsTrie, board));
+        expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+
+        const WordIdSet found{findValidWordIdsInBoard(dictionary, board)};
+        EXPECT_EQ(found.size(), expected.size());
+        EXPECT_EQ(found.toStrings(), expected) << board.rows << "x" << board.columns;
+
+        findValidWordIdsInBoard(dictionary, board, allBoards);
+    }
+    EXPECT_EQ(allBoards, findValidWordIdsInBoard(dictionary, boards[0])
+                             | findValidWordIdsInBoard(dictionary, boards[1])
+                             | findValidWordIdsInBoard(dictionary, boards[2]));
+}
+
+TEST_F(BoggleEnginesTest, WordIdSetOperations)
+{
+    const WordIndex dictionary{Trie{std::vector<std::string_view>{"CAT", "CATS", "DOG", "ZOO"}}};
+    WordIdSet first{dictionary};
+    WordIdSet second{dictionary};
+    for (const auto word : {"CATS", "ZOO", "CAT"})
+    {
+        first.insert(dictionary.find(word));
+    }
+    for (const auto word : {"DOG", "CAT"})
+    {
+        second.insert(dictionary.find(word));
+    }
+
+    using Words = std::vector<std::string_view>;
+    EXPECT_EQ(first.words(), (Words{"CAT", "CATS", "ZOO"}));
+    EXPECT_EQ((first | second).words(), (Words{"CAT", "CATS", "DOG", "ZOO"}));
+    EXPECT_EQ((first & second).words(), (Words{"CAT"}));
+    EXPECT_EQ((first - second).words(), (Words{"CATS", "ZOO"}));
+    EXPECT_TRUE(first.contains("ZOO"));
+    EXPECT_FALSE(first.contains("DOG"));
+    EXPECT_FALSE(first.contains("COW"));
+
+    first.clear();
+    EXPECT_TRUE(first.empty());
+    EXPECT_EQ(first.begin(), first.end());
+
+    const WordIndex otherDictionary{wordsTrie};
+    WordIdSet other{otherDictionary};
+    EXPECT_THROW(first |= other, std::invalid_argument);
+}
+
+TEST_F(BoggleEnginesTest, TrieAllocatesFromMemoryResource)
+{
+    CountingResource resource;
+    {
+        const Trie resourceTrie{EXTENDED_WORD_LIST, &resource};
+
+        EXPECT_EQ(resourceTrie.getMemoryResource(), &resource);
+        EXPECT_EQ(resourceTrie.getWords(), wordsTrie.getWords());
+        EXPECT_EQ(resourceTrie.getNodeCount(), wordsTrie.getNodeCount());
+        // At least the non-root nodes themselves
+        EXPECT_GE(resource.allocations, resourceTrie.getNodeCount() - 1);
+
+        // A copy allocates from the default resource, like the std::pmr containers
+        const size_t allocations{resource.allocations};
+        const Trie copy{resourceTrie};
+        EXPECT_EQ(copy.getMemoryResource(), std::pmr::get_default_resource());
+        EXPECT_EQ(copy.getWords(), wordsTrie.getWords());
+        EXPECT_EQ(resource.allocations, allocations);
+    }
+    EXPECT_EQ(resource.deallocations, resource.allocations);
+    EXPECT_EQ(resource.bytesInUse, 0u);
+
+    // A node moved into another resource is copied into it
+    Node root{Node::allocator_type{&resource}};
+    Node child{Node{}, 'A'};
+    child.addChildNode(Node{child, 'B'});
+    const Node* moved = root.addChildNode(std::move(child));
+    EXPECT_EQ(moved->get_allocator().resource(), &resource);
+    ASSERT_EQ(moved->getNumChildren(), 1u);
+    EXPECT_EQ(moved->getChildAtIndex(0)->getKey(), "AB");
+    EXPECT_EQ(moved->getChildAtIndex(0)->get_allocator().resource(), &resource);
+}
+
+TEST_F(BoggleEnginesTest, PackedSolveOnMemoryResourceMatchesDefault)
+{
+    const PackedTrie packedTrie{wordsTrie};
+    std::pmr::monotonic_buffer_resource arena;
+    CountingResource counting;
+
+    for (const auto& board : createBoards<16, 16>(5))
+    {
+        const auto expected = findValidWordsInBoardPacked(packedTrie, board);
+
+        const auto arenaWords = findValidWordsInBoardPacked(packedTrie, board, &arena);
+        ASSERT_EQ(arenaWords.size(), expected.size());
+        EXPECT_TRUE(std::equal(arenaWords.begin(), arenaWords.end(), expected.begin(),
+                               [](const auto& left, const auto& right)
+                               { return std::string_view{left} == right; }));
+        EXPECT_EQ(arenaWords.get_allocator().resource(), &arena);
+
+        const auto countedWords = findValidWordsInBoardPacked(packedTrie, board, &counting);
+        EXPECT_EQ(countedWords.size(), expected.size());
+        EXPECT_GT(counting.allocations, 0u);
+    }
+}
+
+TEST_F(BoggleEnginesTest, DictionaryBackendsMatchTrieContains)
+{
+    const TrieTable wordsTable{wordsTrie};
+    const PackedTrie packedTrie{wordsTrie};
+    const PerfectHashDictionary perfectHash{wordsTrie};
+    EXPECT_EQ(perfectHash.prefixCount(), wordsTrie.getNodeCount());
+    EXPECT_LE(perfectHash.memoryBytes(), wordsTrie.getNodeCount() * 10);
+
+    for (const auto word : EXTENDED_WORD_LIST)
+    {
+        // The word, its prefixes, and strings which leave the trie at every position
+        for (size_t length{0}; length <= word.size(); length++)
+        {
+            std::string probe{word.substr(0, length)};
+            for (const std::string& candidate : {probe, probe + "Q", probe + "#", "X" + probe})
+            {
+                const inTrie expected{wordsTrie.contains(candidate)};
+                EXPECT_EQ(containsWith(TrieDictionary{wordsTrie}, candidate), expected);
+                EXPECT_EQ(containsWith(TrieTableDictionary{wordsTable}, candidate), expected);
+                EXPECT_EQ(containsWith(PackedTrieDictionary{packedTrie}, candidate), expected);
+                EXPECT_EQ(containsWith(perfectHash, candidate), expected) << candidate;
+            }
+        }
+    }
+
+    // Dead states stay dead
+    PerfectHashDictionary::State dead{perfectHash.step(perfectHash.start(), '#')};
+    EXPECT_FALSE(perfectHash.isPrefix(dead));
+    EXPECT_FALSE(perfectHash.isPrefix(perfectHash.step(dead, 'A')));
+}
+
+TEST_F(BoggleEnginesTest, TemplatedSolversMatchPathSolveForEveryBackend)
+{
+    const TrieTable wordsTable{wordsTrie};
+    const PackedTrie packedTrie{wordsTrie, TrieLayout::vanEmdeBoas};
+    const PerfectHashDictionary perfectHash{wordsTrie};
+
+    for (const auto& board : {createBoggleBoard<4, 4>(), createBoggleBoard<16, 16>(),
+                              createBoggleBoard<3, 9>()})
+    {
+        // The path solve walks the trie on its own, and finds the words in the same order
+        std::vector<std::string> expected;
+        for (const auto& wordPath : findWordPathsInBoard(wordsTrie, board))
+        {
+            expected.push_back(wordPath.word);
+        }
+
+        auto expectBothMatch = [&board, &expected](const auto& dictionary)
+        {
+            EXPECT_EQ(findValidWordsInBoardWith(dictionary, board), expected);
+            EXPECT_EQ(findValidWordsInBoardIterativeWith(dictionary, board), expected);
+        };
+        expectBothMatch(TrieDictionary{wordsTrie});
+        expectBothMatch(TrieTableDictionary{wordsTable});
+        expectBothMatch(PackedTrieDictionary{packedTrie});
+        expectBothMatch(perfectHash);
+        EXPECT_EQ(findValidWordsInBoardRecursive(wordsTrie, board), expected);
+        EXPECT_EQ(findValidWordsInBoardIterative(wordsTrie, board), expected);
+    }
+}
+
+TEST_F(BoggleEnginesTest, ZOrderBoardMatchesRowMajor)
+{
+    const PackedTrie packedTrie{wordsTrie, TrieLayout::vanEmdeBoas};
+    for (const auto& board : {createBoggleBoard<4, 4>(), createBoggleBoard<5, 7>(),
+                              createBoggleBoard<1, 20>(), createBoggleBoard<20, 1>(),
+                              createBoggleBoard<32, 32>(), createBoggleBoard<33, 17>()})
+    {
+        const ZOrderBoard zOrder{board};
+
+        std::set<size_t> indices;
+        for (size_t r{0}; r < board.rows; r++)
+        {
+            for (size_t c{0}; c < board.columns; c++)
+            {
+                EXPECT_EQ(zOrder.getLetter(r, c), board.getLetter(r, c));
+                EXPECT_LT(zOrder.cellIndex(r, c), zOrder.table.size());
+                indices.insert(zOrder.cellIndex(r, c));
+            }
+        }
+        EXPECT_EQ(indices.size(), board.rows * board.columns);
+        EXPECT_EQ(zOrder.toBoard().table, board.table);
+        EXPECT_EQ(findValidWordsInBoardPacked(packedTrie, zOrder),
+                  findValidWordsInBoardPacked(packedTrie, board));
+        EXPECT_EQ(findValidWordsInBoardRecursive(wordsTrie, zOrder),
+                  findValidWordsInBoardRecursive(wordsTrie, board));
+        EXPECT_EQ(findValidWordsInBoardIterative(wordsTrie, zOrder),
+                  findValidWordsInBoardIterative(wordsTrie, board));
+    }
+
+    Board withBlank = createBoggleBoard<5, 7>();
+    withBlank.table[12] = wildcardTile;
+    const ZOrderBoard blank{withBlank};
+    EXPECT_TRUE(blank.hasWildcard());
+    EXPECT_FALSE((ZOrderBoard{createBoggleBoard<5, 7>()}.hasWildcard()));
+    EXPECT_THROW(findValidWordsInBoardRecursive(wordsTrie, blank), std::invalid_argument);
+    EXPECT_THROW(findValidWordsInBoardIterative(wordsTrie, blank), std::invalid_argument);
+
+    // 2x2 blocks along the columns: the cells of each block are consecutive
+    const ZOrderBoard wide{createBoggleBoard<2, 4>()};
+    EXPECT_EQ(wide.cellIndex(0, 1), 1u);
+    EXPECT_EQ(wide.cellIndex(1, 0), 2u);
+    EXPECT_EQ(wide.cellIndex(1, 1), 3u);
+    EXPECT_EQ(wide.cellIndex(0, 2), 4u);
+}
+
+TEST_F(BoggleEnginesTest, WildcardsMatchLetterSubstitution)
+{
+    const PackedTrie packedTrie{wordsTrie, TrieLayout::vanEmdeBoas};
+    for (size_t nBlanks{1}; nBlanks <= 2; nBlanks++)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            // Blanks on the diagonal, so that paths can take both
+            Board board{createBoggleBoard<4, 4>()};
+            for (size_t blank{0}; blank < nBlanks; blank++)
+            {
+                board.table[blank * 5] = wildcardTile;
+            }
+
+            // Reference: every assignment of letters to the blanks, solved as an ordinary board
+            std::set<std::string> expectedWords;
+            std::set<std::pair<std::string, std::vector<size_t>>> expectedPaths;
+            size_t nAssignments{1};
+            for (size_t blank{0}; blank < nBlanks; blank++)
+            {
+                nAssignments *= 26;
+            }
+            for (size_t assignment{0}; assignment < nAssignments; assignment++)
+            {
+                Board filled{board};
+                for (size_t blank{0}, rest{assignment}; blank < nBlanks; blank++, rest /= 26)
+                {
+                    filled.table[blank * 5] = static_cast<char>('A' + rest % 26);
+                }
+                for (const auto& word : findValidWordsInBoardPacked(packedTrie, filled))
+                {
+                    expectedWords.insert(word);
+                }
+                for (const auto& wordPath : findWordPathsInBoard(wordsTrie, filled))
+                {
+                    expectedPaths.emplace(wordPath.word, wordPath.cells);
+                }
+            }
+
+            const auto words = findValidWordsInBoardPacked(packedTrie, board);
+            EXPECT_EQ(std::set<std::string>(words.begin(), words.end()), expectedWords);
+            EXPECT_EQ(countValidWordsInBoard(wordsTrie, board), expectedWords.size());
+
+            // Every path once, with the letters of its blanks (lower case in the marked words)
+            std::set<std::pair<std::string, std::vector<size_t>>> paths;
+            std::set<std::string> expectedMarked;
+            for (const auto& wordPath : findWordPathsInBoard(wordsTrie, board))
+            {
+                EXPECT_TRUE(paths.emplace(wordPath.word, wordPath.cells).second) << wordPath.word;
+                std::string marked{wordPath.word};
+                std::string blankLetters;
+                for (size_t k{0}; k < wordPath.cells.size(); k++)
+                {
+                    if (board.table[wordPath.cells[k]] == wildcardTile)
+                    {
+                        blankLetters += wordPath.word[k];
+                        marked[k] = static_cast<char>(marked[k] - 'A' + 'a');
+                    }
+                }
+                EXPECT_EQ(wordPath.blankLetters, blankLetters) << wordPath.word;
+                expectedMarked.insert(marked);
+            }
+            EXPECT_EQ(paths, expectedPaths);
+            const auto marked = findBlankMarkedWordsPacked(packedTrie, board);
+            EXPECT_EQ(std::set<std::string>(marked.begin(), marked.end()), expectedMarked);
+        }
+    }
+}
+
+TEST_F(BoggleEnginesTest, EnginesRejectBlanksUnlessSupported)
+{
+    const PackedTrie packedTrie{wordsTrie, TrieLayout::vanEmdeBoas};
+    Board board{createBoggleBoard<4, 4>()};
+    board.table[5] = wildcardTile;
+    const auto expected = findValidWordsInBoardPacked(packedTrie, board);
+    for (const auto& engine : getSolverEngines())
+    {
+        const BoardSolver solve{engine.prepare(wordsTrie)};
+        if (engine.supportsBlanks)
+        {
+            const auto words = solve(board);
+            EXPECT_EQ(std::set<std::string>(words.begin(), words.end()),
+                      std::set<std::string>(expected.begin(), expected.end()))
+                << engine.name;
+        }
+        else
+        {
+            EXPECT_THROW(solve(board), std::invalid_argument) << engine.name;
+        }
+    }
+}
@@ -19,8 +19,10 @@ protected:
 
     // Map of algorithm names to their implementations
     std::unordered_map<std::string, AlgorithmFunction> algorithms
-        = {{"Recursive", findValidWordsInBoardRecursive},
-           {"Iterative", findValidWordsInBoardIterative}};
+        = {{"Recursive", [](const Trie& wordsTrie, const Board& board)
+            { return findValidWordsInBoardRecursive(wordsTrie, board); }},
+           {"Iterative", [](const Trie& wordsTrie, const Board& board)
+            { return findValidWordsInBoardIterative(wordsTrie, board); }}};
 
     // Measure performance of a single algorithm
     Duration measureAlgorithmPerformance(const std::string& algorithmName, const Trie& wordsTrie,
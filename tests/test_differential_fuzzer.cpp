@@ -0,0 +1,100 @@
+#include "Board.h"
+#include "boggle_algorithm.h"
+#include "boggle_engines.h"
+#include "differential_fuzzer.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace
+{
+// Engine which misses every word of three letters or more
+const SolverEngine shortWordsOnly{
+    "short-words-only",
+    [](const Trie& wordsTrie) -> BoardSolver
+    {
+        return [&wordsTrie](const Board& board)
+        {
+            auto words = findValidWordsInBoardRecursive(wordsTrie, board);
+            std::erase_if(words, [](const std::string& word) { return word.size() >= 3; });
+            return words;
+        };
+    }};
+} // namespace
+
+TEST(DifferentialFuzzerTest, ReferenceOnlyFindsSpellableWords)
+{
+    FuzzCase fuzzCase;
+    fuzzCase.board.rows = 1;
+    fuzzCase.board.columns = 4;
+    fuzzCase.board.table = {'C', 'A', 'T', 'S'};
+    // CAC reuses a cell, C and T aren't adjacent, TT has a single T
+    fuzzCase.words = {"CAT", "CATS", "STAC", "CAC", "CT", "TT", "A", "CAT"};
+
+    const std::vector<std::string> expected{"A", "CAT", "CATS", "STAC"};
+    EXPECT_EQ(solveReference(fuzzCase), expected);
+}
+
+TEST(DifferentialFuzzerTest, GeneratedCasesAreReproducible)
+{
+    const FuzzConfig config;
+    const FuzzCase first{generateFuzzCase(3, 10, config)};
+    const FuzzCase again{generateFuzzCase(3, 10, config)};
+    const FuzzCase next{generateFuzzCase(3, 11, config)};
+
+    EXPECT_EQ(first.board.table, again.board.table);
+    EXPECT_EQ(first.words, again.words);
+    EXPECT_TRUE(first.board.table != next.board.table || first.words != next.words);
+    EXPECT_LE(first.board.rows, config.maxSide);
+    EXPECT_LE(first.words.size(), config.maxWords);
+}
+
+TEST(DifferentialFuzzerTest, CaseRoundTripsThroughText)
+{
+    const FuzzCase fuzzCase{generateFuzzCase(5, 0, FuzzConfig{})};
+    std::stringstream text;
+    text << "# comment\n";
+    writeFuzzCase(text, fuzzCase);
+    const FuzzCase read{readFuzzCase(text)};
+
+    EXPECT_EQ(read.board.rows, fuzzCase.board.rows);
+    EXPECT_EQ(read.board.columns, fuzzCase.board.columns);
+    EXPECT_EQ(read.board.table, fuzzCase.board.table);
+    EXPECT_EQ(read.words, fuzzCase.words);
+
+    std::stringstream truncated("board 2 2\nAB\n");
+    EXPECT_THROW(readFuzzCase(truncated), std::invalid_argument);
+}
+
+TEST(DifferentialFuzzerTest, RegisteredEnginesMatchReference)
+{
+    const auto result = runDifferentialFuzz(getSolverEngines(), FuzzConfig{}, 7, 100, 2);
+
+    EXPECT_EQ(result.casesRun, 100u);
+    EXPECT_FALSE(result.failure.has_value())
+        << "Engine " << result.failure->mismatch.engine << " fails case "
+        << result.failure->caseIndex;
+}
+
+TEST(DifferentialFuzzerTest, BrokenEngineIsCaughtAndMinimized)
+{
+    const std::vector<SolverEngine> engines{getSolverEngines().front(), shortWordsOnly};
+    const auto result = runDifferentialFuzz(engines, FuzzConfig{}, 7, 300, 3);
+    ASSERT_TRUE(result.failure.has_value());
+
+    // The first failing case doesn't depend on the number of threads
+    const auto singleThreaded = runDifferentialFuzz(engines, FuzzConfig{}, 7, 300, 1);
+    ASSERT_TRUE(singleThreaded.failure.has_value());
+    EXPECT_EQ(result.failure->caseIndex, singleThreaded.failure->caseIndex);
+
+    // A single three-letter word, on a board no larger than needed to spell it
+    const FuzzFailure& failure = *result.failure;
+    EXPECT_EQ(failure.mismatch.engine, "short-words-only");
+    ASSERT_EQ(failure.minimized.words.size(), 1u);
+    EXPECT_EQ(failure.minimized.words.front().size(), 3u);
+    EXPECT_EQ(failure.mismatch.missing, failure.minimized.words);
+    EXPECT_LE(failure.minimized.board.rows * failure.minimized.board.columns, 4u);
+}
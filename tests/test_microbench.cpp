@@ -0,0 +1,128 @@
+#include "microbench.h"
+
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+MicrobenchResult resultOf(const std::string& name, double medianNs, double minNs)
+{
+    MicrobenchResult result;
+    result.name = name;
+    result.medianNs = medianNs;
+    result.minNs = minNs;
+    return result;
+}
+} // namespace
+
+// Benchmark JSON files, written to the temporary directory
+class MicrobenchJsonTest : public ::testing::Test
+{
+protected:
+    MicrobenchJsonTest()
+        : path{(std::filesystem::temp_directory_path()
+                / (std::string("boggle_test_")
+                   + ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".json"))
+                   .string()}
+    {
+    }
+
+    [[maybe_unused]] void TearDown() override
+    {
+        std::filesystem::remove(path);
+    }
+
+    std::string path;
+};
+
+TEST(MicrobenchTest, SummarizesSamples)
+{
+    const MicrobenchResult result{summarizeMicrobench("case", {5, 1, 3, 2, 4})};
+    EXPECT_EQ(result.name, "case");
+    EXPECT_EQ(result.repetitions, 5u);
+    EXPECT_EQ(result.iterationsPerRepetition, 1u);
+    EXPECT_DOUBLE_EQ(result.medianNs, 3);
+    EXPECT_DOUBLE_EQ(result.p99Ns, 5);
+    EXPECT_DOUBLE_EQ(result.minNs, 1);
+    EXPECT_DOUBLE_EQ(result.meanNs, 3);
+    EXPECT_DOUBLE_EQ(result.stddevNs, std::sqrt(2.5));
+
+    const MicrobenchResult single{summarizeMicrobench("single", {7})};
+    EXPECT_DOUBLE_EQ(single.medianNs, 7);
+    EXPECT_DOUBLE_EQ(single.p99Ns, 7);
+    EXPECT_DOUBLE_EQ(single.stddevNs, 0);
+
+    EXPECT_THROW(summarizeMicrobench("empty", {}), std::invalid_argument);
+}
+
+TEST(MicrobenchTest, RegressionsNeedMedianAndMinimumSlower)
+{
+    const std::vector<MicrobenchResult> baseline{resultOf("slower", 100, 90),
+                                                 resultOf("noisy", 100, 90),
+                                                 resultOf("faster", 100, 90),
+                                                 resultOf("removed", 100, 90)};
+    const std::vector<MicrobenchResult> results{resultOf("slower", 110, 100),
+                                                resultOf("noisy", 110, 92),
+                                                resultOf("faster", 90, 80),
+                                                resultOf("added", 500, 500)};
+    const auto comparisons = compareMicrobench(baseline, results, 0.05);
+
+    // Cases missing from either side are skipped
+    ASSERT_EQ(comparisons.size(), 3u);
+    EXPECT_EQ(comparisons[0].name, "slower");
+    EXPECT_DOUBLE_EQ(comparisons[0].baselineNs, 100);
+    EXPECT_DOUBLE_EQ(comparisons[0].currentNs, 110);
+    EXPECT_NEAR(comparisons[0].change, 0.1, 1e-12);
+    EXPECT_TRUE(comparisons[0].regression);
+    EXPECT_EQ(comparisons[1].name, "noisy"); // median slower, fastest repetition within threshold
+    EXPECT_FALSE(comparisons[1].regression);
+    EXPECT_EQ(comparisons[2].name, "faster");
+    EXPECT_NEAR(comparisons[2].change, -0.1, 1e-12);
+    EXPECT_FALSE(comparisons[2].regression);
+
+    // Within the threshold, or against a baseline without a minimum
+    EXPECT_FALSE(compareMicrobench(baseline, {resultOf("slower", 104, 100)}, 0.05)[0].regression);
+    const auto withoutMinimum = compareMicrobench({resultOf("old", 100, 0)},
+                                                  {resultOf("old", 110, 1)}, 0.05);
+    EXPECT_TRUE(withoutMinimum[0].regression);
+}
+
+TEST_F(MicrobenchJsonTest, ResultsRoundTrip)
+{
+    std::vector<MicrobenchResult> results{summarizeMicrobench("solve/packed/4x4", {1500.25, 1400}),
+                                          summarizeMicrobench("name with \"quotes\"", {3, 2, 1})};
+    {
+        std::ofstream out(path);
+        writeMicrobenchJson(out, results);
+    }
+
+    const auto read = readMicrobenchJson(path);
+    ASSERT_EQ(read.size(), results.size());
+    for (size_t i{0}; i < results.size(); i++)
+    {
+        EXPECT_EQ(read[i].name, results[i].name);
+        EXPECT_NEAR(read[i].medianNs, results[i].medianNs, 0.005);
+        EXPECT_NEAR(read[i].minNs, results[i].minNs, 0.005);
+    }
+
+    // A run compared against its own baseline has no regression
+    for (const auto& comparison : compareMicrobench(read, results, 0.05))
+    {
+        EXPECT_FALSE(comparison.regression) << comparison.name;
+    }
+}
+
+TEST_F(MicrobenchJsonTest, RejectsMissingOrMalformedFiles)
+{
+    EXPECT_THROW(readMicrobenchJson(path), std::runtime_error);
+    {
+        std::ofstream out(path);
+        out << "{\"benchmarks\": [{\"median_ns\": 1.00}]}";
+    }
+    EXPECT_THROW(readMicrobenchJson(path), std::runtime_error);
+}
@@ -0,0 +1,138 @@
+#include "Board.h"
+#include "BoardGenerator.h"
+#include "BoundedQueue.h"
+#include "PackedTrie.h"
+#include "Trie.h"
+#include "boggle_packed.h"
+#include "boggle_pipeline.h"
+#include "word_list.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Streaming pipeline: reader thread, solver threads and an ordered writer
+class PipelineTest : public ::testing::Test
+{
+protected:
+    PipelineTest() : wordsTrie{Trie{EXTENDED_WORD_LIST}, TrieLayout::vanEmdeBoas}
+    {
+    }
+
+    // Input of random boards, and the output expected for it, solved on this thread
+    void makeBoards(size_t count, std::string& input, std::string& expected) const
+    {
+        BoardGenerator generator{DiceSet::classic4x4, 4, 4, 9};
+        for (size_t i{0}; i < count; i++)
+        {
+            const Board board{generator.next()};
+            input += formatBoardLine(board) + "\n";
+
+            auto words = findValidWordsInBoardPacked(wordsTrie, board);
+            std::sort(words.begin(), words.end());
+            words.erase(std::unique(words.begin(), words.end()), words.end());
+            expected += formatBoardLine(board) + ":";
+            for (const auto& word : words)
+            {
+                expected += " " + word;
+            }
+            expected += "\n";
+        }
+    }
+
+    PackedTrie wordsTrie;
+};
+
+TEST_F(PipelineTest, BoardLinesRoundTrip)
+{
+    const auto board = parseBoardLine("  TAPS ONED\tRATI MSEG\r");
+    ASSERT_TRUE(board.has_value());
+    EXPECT_EQ(board->rows, 4u);
+    EXPECT_EQ(board->columns, 4u);
+    EXPECT_EQ(board->getLetter(2, 3), 'I');
+    EXPECT_EQ(formatBoardLine(*board), "TAPS ONED RATI MSEG");
+
+    EXPECT_FALSE(parseBoardLine("").has_value());
+    EXPECT_FALSE(parseBoardLine("   ").has_value());
+    EXPECT_FALSE(parseBoardLine("TAPS ONE RATI").has_value());
+    EXPECT_EQ(parseBoardLine("ABCDEFG")->rows, 1u);
+    EXPECT_EQ(parseBoardLine("T?PS ONED")->getLetter(0, 1), wildcardTile);
+
+    // Only uppercase letters and blanks: lowercase marks the letter of a blank in the output
+    EXPECT_FALSE(parseBoardLine("taps oned rati mseg").has_value());
+    EXPECT_FALSE(parseBoardLine("TA1S ONED RATI MSEG").has_value());
+    EXPECT_FALSE(parseBoardLine("TAPS ONED RATI MSe").has_value());
+    EXPECT_FALSE(parseBoardLine("TAPS ON-D").has_value());
+}
+
+TEST_F(PipelineTest, OutputIsInInputOrder)
+{
+    std::string input;
+    std::string expected;
+    makeBoards(2000, input, expected);
+
+    // Tiny batches and queues, so that batches finish out of order and producers wait
+    for (const PipelineConfig& config : {PipelineConfig{1, 256, 16}, PipelineConfig{4, 1, 1},
+                                         PipelineConfig{3, 7, 2}})
+    {
+        std::istringstream in{input};
+        std::ostringstream out;
+        const PipelineReport report{runPipeline(wordsTrie, in, out, config)};
+        EXPECT_EQ(out.str(), expected);
+        EXPECT_EQ(report.boardsSolved, 2000u);
+        EXPECT_EQ(report.invalidLines, 0u);
+        EXPECT_GT(report.wordsFound, 0u);
+    }
+}
+
+TEST_F(PipelineTest, InvalidLinesAreReportedInPlace)
+{
+    std::istringstream in{"# comment\n\nCAT RED SIN\nAB C\ncat red sin\nCAT RED SIN\n"};
+    std::ostringstream out;
+    const PipelineReport report{runPipeline(wordsTrie, in, out, PipelineConfig{2, 1, 1})};
+    const std::string line{out.str().substr(0, out.str().find('\n') + 1)};
+    EXPECT_EQ(out.str(), line + "# line 4: invalid board\n# line 5: invalid board\n" + line);
+    EXPECT_EQ(report.boardsSolved, 2u);
+    EXPECT_EQ(report.invalidLines, 2u);
+
+    std::istringstream empty{""};
+    std::ostringstream none;
+    EXPECT_EQ(runPipeline(wordsTrie, empty, none, PipelineConfig{}).boardsSolved, 0u);
+    EXPECT_TRUE(none.str().empty());
+    EXPECT_THROW(runPipeline(wordsTrie, empty, none, PipelineConfig{0, 1, 1}),
+                 std::invalid_argument);
+}
+
+TEST_F(PipelineTest, BlankWordsAreListedOnce)
+{
+    // AND and DEAN are also spelled through the blank (ANd, aND, DEaN): only the first form is kept
+    const PackedTrie smallTrie{Trie{std::vector<std::string_view>{"AND", "DEAN", "NEAR"}}};
+    std::istringstream in("AN? DEA\n");
+    std::ostringstream out;
+    const PipelineReport report{runPipeline(smallTrie, in, out, PipelineConfig{1, 1, 1})};
+    EXPECT_EQ(out.str(), "AN? DEA: AND DEAN NEAr\n");
+    EXPECT_EQ(report.wordsFound, 3u);
+}
+
+TEST(BoundedQueueTest, BlocksWhenFullAndDrainsAfterClose)
+{
+    BoundedQueue<int> queue{2};
+    EXPECT_TRUE(queue.push(1));
+    EXPECT_TRUE(queue.push(2));
+
+    // A third push waits until an item is taken
+    std::thread producer([&queue] { EXPECT_TRUE(queue.push(3)); });
+    EXPECT_EQ(queue.pop(), 1);
+    producer.join();
+    EXPECT_EQ(queue.size(), 2u);
+
+    queue.close();
+    EXPECT_FALSE(queue.push(4));
+    EXPECT_EQ(queue.pop(), 2);
+    EXPECT_EQ(queue.pop(), 3);
+    EXPECT_EQ(queue.pop(), std::nullopt);
+    EXPECT_THROW(BoundedQueue<int>{0}, std::invalid_argument);
+}
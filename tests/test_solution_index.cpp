@@ -0,0 +1,140 @@
+#include "Board.h"
+#include "SolutionIndex.h"
+#include "Trie.h"
+#include "boggle_algorithm.h"
+#include "create_boggle_board.h"
+#include "word_list.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <set>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace
+{
+Board boardOf(size_t rows, size_t columns, std::string_view letters)
+{
+    Board board;
+    board.rows = rows;
+    board.columns = columns;
+    board.table.assign(letters.begin(), letters.end());
+    return board;
+}
+
+// Function to get the words of ids, for comparisons
+std::vector<std::string> wordsOf(const SolutionIndex& index, std::span<const uint32_t> ids)
+{
+    std::vector<std::string> words;
+    for (const uint32_t id : ids)
+    {
+        words.emplace_back(index.word(id));
+    }
+    return words;
+}
+} // namespace
+
+TEST(SolutionIndexTest, QueriesMatchWordPaths)
+{
+    const Trie wordsTrie{EXTENDED_WORD_LIST};
+    for (const auto& board : {createBoggleBoard<4, 4>(), createBoggleBoard<7, 3>(),
+                              createBoggleBoard<16, 16>()})
+    {
+        const auto wordPaths = findWordPathsInBoard(wordsTrie, board);
+        const SolutionIndex index{board, wordPaths};
+
+        // Reference answers from the paths
+        std::set<std::string> words;
+        std::vector<std::set<std::string>> throughCell(index.cellCount());
+        std::vector<std::set<std::string>> startingAt(index.cellCount());
+        for (const auto& wordPath : wordPaths)
+        {
+            words.insert(wordPath.word);
+            for (const size_t cell : wordPath.cells)
+            {
+                throughCell[cell].insert(wordPath.word);
+            }
+            startingAt[wordPath.cells.front()].insert(wordPath.word);
+        }
+
+        ASSERT_EQ(index.wordCount(), words.size());
+        uint32_t id{0};
+        for (const auto& word : words)
+        {
+            EXPECT_EQ(index.word(id), word);
+            EXPECT_EQ(index.find(word), id);
+            EXPECT_EQ(index.findPathWord(index.path(id)), id) << word;
+            for (size_t length{0}; length <= word.size(); length++)
+            {
+                const std::string prefix{word.substr(0, length)};
+                const SolutionIndex::WordRange range{index.wordsWithPrefix(prefix)};
+                const auto expected = std::count_if(words.begin(), words.end(),
+                                                    [&prefix](const std::string& other)
+                                                    { return other.starts_with(prefix); });
+                EXPECT_EQ(range.size(), static_cast<size_t>(expected)) << prefix;
+                EXPECT_LE(range.first, id);
+                EXPECT_GT(range.last, id);
+            }
+            id++;
+        }
+        EXPECT_EQ(index.find("ZZZZ"), SolutionIndex::noWord);
+        EXPECT_TRUE(index.wordsWithPrefix("ZZZZ").empty());
+
+        for (size_t cell{0}; cell < index.cellCount(); cell++)
+        {
+            const auto through = wordsOf(index, index.wordsThroughCell(cell));
+            EXPECT_EQ(std::set<std::string>(through.begin(), through.end()), throughCell[cell]);
+            EXPECT_EQ(through.size(), throughCell[cell].size());
+            const auto starting = wordsOf(index, index.wordsStartingAt(cell));
+            EXPECT_EQ(std::set<std::string>(starting.begin(), starting.end()), startingAt[cell]);
+            EXPECT_EQ(starting.size(), startingAt[cell].size());
+        }
+    }
+}
+
+TEST(SolutionIndexTest, ChecksTracedPaths)
+{
+    const Trie wordsTrie{std::vector<std::string_view>{"TAPS", "TAP", "SEG", "PAT", "DOG"}};
+    const SolutionIndex index{wordsTrie, boardOf(4, 4, "TAPSONEDRATIMSEG")};
+    const uint32_t taps{index.find("TAPS")};
+    ASSERT_NE(taps, SolutionIndex::noWord);
+
+    EXPECT_EQ(index.findPathWord(std::vector<uint32_t>{0, 1, 2, 3}), taps);
+    EXPECT_EQ(index.findPathWord(std::vector<uint32_t>{0, 1, 2}), index.find("TAP"));
+    EXPECT_EQ(index.findPathWord(std::vector<uint32_t>{0, 1}), SolutionIndex::noWord); // not a word
+    EXPECT_EQ(index.findPathWord(std::vector<uint32_t>{0, 1, 3}), SolutionIndex::noWord); // gap
+    EXPECT_EQ(index.findPathWord(std::vector<uint32_t>{2, 1, 0, 1}), SolutionIndex::noWord);
+    EXPECT_EQ(index.findPathWord(std::vector<uint32_t>{3, 4}), SolutionIndex::noWord); // wraps
+    EXPECT_EQ(index.findPathWord(std::vector<uint32_t>{0, 16}), SolutionIndex::noWord);
+    EXPECT_EQ(index.findPathWord({}), SolutionIndex::noWord);
+    EXPECT_EQ(index.find("DOG"), SolutionIndex::noWord); // not on the board
+
+    // The player names the letters of the blanks
+    const SolutionIndex blankIndex{wordsTrie, boardOf(2, 2, "T?PS")};
+    const std::vector<uint32_t> tap{0, 1, 2};
+    EXPECT_EQ(blankIndex.findPathWord(tap, "A"), blankIndex.find("TAP"));
+    EXPECT_EQ(blankIndex.findPathWord(tap, "O"), SolutionIndex::noWord);
+    EXPECT_EQ(blankIndex.findPathWord(tap), SolutionIndex::noWord);
+    EXPECT_EQ(blankIndex.findPathWord(tap, "AA"), SolutionIndex::noWord);
+    EXPECT_EQ(index.blankLetters(taps), "");
+
+    // The index keeps the letters its paths give to the blanks
+    for (uint32_t id{0}; id < blankIndex.wordCount(); id++)
+    {
+        EXPECT_EQ(blankIndex.blankLetters(id), "A") << blankIndex.word(id);
+        EXPECT_EQ(blankIndex.findPathWord(blankIndex.path(id), blankIndex.blankLetters(id)), id)
+            << blankIndex.word(id);
+    }
+    EXPECT_EQ(blankIndex.blankLetters(blankIndex.find("TAP")), "A");
+    EXPECT_EQ(blankIndex.wordsThroughCell(1).size(), 3u); // TAP, TAPS and PAT
+    EXPECT_EQ(wordsOf(blankIndex, blankIndex.wordsStartingAt(2)), std::vector<std::string>{"PAT"});
+}
+
+TEST(SolutionIndexTest, RejectsPathsOffTheBoard)
+{
+    const Board board{boardOf(2, 2, "ABCD")};
+    EXPECT_THROW(SolutionIndex(board, {WordPath{"AB", {0, 4}}}), std::invalid_argument);
+    EXPECT_THROW(SolutionIndex(board, {WordPath{"AB", {0}}}), std::invalid_argument);
+    EXPECT_EQ(SolutionIndex(board, {}).wordCount(), 0u);
+}
@@ -0,0 +1,177 @@
+#include "Board.h"
+#include "BoardSymmetry.h"
+#include "SolveCache.h"
+#include "Trie.h"
+#include "boggle_algorithm.h"
+#include "boggle_boards.h"
+#include "create_boggle_board.h"
+#include "word_list.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+std::vector<std::string> sortedWords(const std::vector<WordPath>& wordPaths)
+{
+    std::vector<std::string> words;
+    for (const auto& wordPath : wordPaths)
+    {
+        words.push_back(wordPath.word);
+    }
+    std::sort(words.begin(), words.end());
+    return words;
+}
+
+// Checks that every path spells its word on board, using adjacent and distinct cells
+void expectPathsValid(const Board& board, const std::vector<WordPath>& wordPaths)
+{
+    for (const auto& wordPath : wordPaths)
+    {
+        ASSERT_EQ(wordPath.word.size(), wordPath.cells.size()) << wordPath.word;
+
+        std::vector<size_t> cells{wordPath.cells};
+        std::sort(cells.begin(), cells.end());
+        EXPECT_EQ(std::adjacent_find(cells.begin(), cells.end()), cells.end())
+            << wordPath.word << " reuses a cell";
+
+        for (size_t i{0}; i < wordPath.cells.size(); i++)
+        {
+            const size_t cell{wordPath.cells[i]};
+            EXPECT_EQ(board.table[cell], wordPath.word[i]) << wordPath.word;
+
+            if (i > 0)
+            {
+                const size_t previous{wordPath.cells[i - 1]};
+                const auto dr{static_cast<long>(cell / board.columns)
+                              - static_cast<long>(previous / board.columns)};
+                const auto dc{static_cast<long>(cell % board.columns)
+                              - static_cast<long>(previous % board.columns)};
+                EXPECT_TRUE(std::abs(dr) <= 1 && std::abs(dc) <= 1)
+                    << wordPath.word << " uses non-adjacent cells";
+            }
+        }
+    }
+}
+} // namespace
+
+TEST(BoardSymmetryTest, AllSymmetriesShareCanonicalKey)
+{
+    Board board = createLargeBoard();
+    auto reference = canonicalizeBoard(board);
+
+    for (const auto symmetry : ALL_BOARD_SYMMETRIES)
+    {
+        auto transformed = applySymmetry(board, symmetry);
+        EXPECT_EQ(canonicalizeBoard(transformed).key, reference.key);
+    }
+}
+
+TEST(BoardSymmetryTest, NonSquareBoardsKeepTheirCells)
+{
+    Board board;
+    board.rows = 2;
+    board.columns = 3;
+    board.table = {'A', 'B', 'C', 'D', 'E', 'F'};
+
+    for (const auto symmetry : ALL_BOARD_SYMMETRIES)
+    {
+        auto transformed = applySymmetry(board, symmetry);
+        EXPECT_EQ(transformed.rows * transformed.columns, 6u);
+        EXPECT_EQ(canonicalizeBoard(transformed).key, canonicalizeBoard(board).key);
+    }
+}
+
+TEST(BoardSymmetryTest, DifferentBoardsHaveDifferentKeys)
+{
+    EXPECT_NE(canonicalizeBoard(createMediumBoard()).key,
+              canonicalizeBoard(createLargeBoard()).key);
+}
+
+TEST(SolveCacheTest, RotatedBoardHitsCacheWithRemappedPaths)
+{
+    Trie wordsTrie{EXTENDED_WORD_LIST};
+    Board board = createBoggleBoard<6, 6>();
+    SolveCache cache(64);
+
+    auto original = cache.solve(wordsTrie, 1, board);
+    expectPathsValid(board, original);
+
+    for (const auto symmetry : ALL_BOARD_SYMMETRIES)
+    {
+        auto transformed = applySymmetry(board, symmetry);
+        auto cached = cache.solve(wordsTrie, 1, transformed);
+
+        expectPathsValid(transformed, cached);
+        EXPECT_EQ(sortedWords(cached), sortedWords(findWordPathsInBoard(wordsTrie, transformed)));
+    }
+
+    auto stats = cache.stats();
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.hits, ALL_BOARD_SYMMETRIES.size());
+    EXPECT_EQ(cache.size(), 1u);
+}
+
+TEST(SolveCacheTest, DictionaryVersionIsPartOfKey)
+{
+    Trie wordsTrie{WORD_LIST};
+    Board board = createMediumBoard();
+    SolveCache cache(8);
+
+    cache.solve(wordsTrie, 1, board);
+    EXPECT_FALSE(cache.lookup(board, 2).has_value());
+    EXPECT_TRUE(cache.lookup(board, 1).has_value());
+}
+
+TEST(SolveCacheTest, EvictsLeastRecentlyUsed)
+{
+    Trie wordsTrie{WORD_LIST};
+    SolveCache cache(1); // a single entry per shard
+
+    std::vector<Board> boards;
+    for (int i{0}; i < 200; i++)
+    {
+        boards.push_back(createBoggleBoard<4, 4>());
+        cache.solve(wordsTrie, 1, boards.back());
+    }
+
+    EXPECT_LE(cache.size(), 16u);
+    EXPECT_GT(cache.stats().evictions, 0u);
+}
+
+TEST(SolveCacheTest, ConcurrentSolvesAgree)
+{
+    Trie wordsTrie{EXTENDED_WORD_LIST};
+    Board board = createBoggleBoard<5, 5>();
+    auto expected = sortedWords(findWordPathsInBoard(wordsTrie, board));
+    SolveCache cache(32);
+
+    std::vector<std::thread> threads;
+    std::vector<std::vector<std::string>> results(4);
+    for (size_t t{0}; t < results.size(); t++)
+    {
+        threads.emplace_back(
+            [&, t]()
+            {
+                auto symmetry = ALL_BOARD_SYMMETRIES[t];
+                for (int i{0}; i < 50; i++)
+                {
+                    results[t] = sortedWords(
+                        cache.solve(wordsTrie, 7, applySymmetry(board, symmetry)));
+                }
+            });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (const auto& result : results)
+    {
+        EXPECT_EQ(result, expected);
+    }
+    EXPECT_GT(cache.stats().hitRate(), 0.9);
+}
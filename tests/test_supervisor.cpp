@@ -0,0 +1,101 @@
+#include "Board.h"
+#include "BoardGenerator.h"
+#include "PackedTrie.h"
+#include "SharedDictionary.h"
+#include "Trie.h"
+#include "boggle_packed.h"
+#include "boggle_supervisor.h"
+#include "word_list.h"
+
+#include <algorithm>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+// Worker processes sharing one dictionary; only on POSIX systems
+class SupervisorTest : public ::testing::Test
+{
+protected:
+    SupervisorTest() : wordsTrie{Trie{EXTENDED_WORD_LIST}, TrieLayout::vanEmdeBoas}
+    {
+    }
+
+    [[maybe_unused]] void SetUp() override
+    {
+        if (!processPoolSupported)
+        {
+            GTEST_SKIP() << "Worker processes need a POSIX system";
+        }
+    }
+
+    // Distinct words of the boards a supervisor run solves, solved in this process
+    uint64_t expectedWords(const SupervisorConfig& config) const
+    {
+        BoardGenerator generator{DiceSet::classic4x4, config.rows, config.columns, config.seed};
+        uint64_t nWords{0};
+        for (size_t i{0}; i < config.boards; i++)
+        {
+            auto words = findValidWordsInBoardPacked(wordsTrie, generator.next());
+            std::sort(words.begin(), words.end());
+            nWords += static_cast<uint64_t>(std::unique(words.begin(), words.end())
+                                            - words.begin());
+        }
+        return nWords;
+    }
+
+    PackedTrie wordsTrie;
+};
+
+TEST_F(SupervisorTest, SharedDictionaryMatchesPackedTrie)
+{
+    const SharedDictionary dictionary{wordsTrie};
+    ASSERT_EQ(dictionary.nodes().size(), wordsTrie.nodeCount());
+    EXPECT_GE(dictionary.sizeBytes(), wordsTrie.nodeCount() * sizeof(PackedTrie::PackedNode));
+
+    BoardGenerator generator{DiceSet::classic4x4, 16, 16, 5};
+    for (int i{0}; i < 5; i++)
+    {
+        const Board board{generator.next()};
+        EXPECT_EQ(findValidWordsInBoardPacked(dictionary.nodes(), board),
+                  findValidWordsInBoardPacked(wordsTrie, board));
+    }
+}
+
+TEST_F(SupervisorTest, SolvesEveryBoardOnce)
+{
+    SupervisorConfig config;
+    config.workers = 3;
+    config.boards = 500;
+    config.rows = 5;
+    config.columns = 5;
+    config.batchSize = 16;
+    config.seed = 11;
+
+    const SupervisorReport report{runSupervisor(wordsTrie, config)};
+    EXPECT_EQ(report.boardsSolved, config.boards);
+    EXPECT_EQ(report.wordsFound, expectedWords(config));
+    EXPECT_EQ(report.restarts, 0u);
+    EXPECT_EQ(report.workerMemoryKb.size(), config.workers);
+}
+
+TEST_F(SupervisorTest, RestartsCrashedWorkerAndRequeuesItsBatch)
+{
+    SupervisorConfig config;
+    config.workers = 2;
+    config.boards = 400;
+    config.batchSize = 8;
+    config.seed = 12;
+    config.crashAfterBatches = 2;
+
+    const SupervisorReport report{runSupervisor(wordsTrie, config)};
+    EXPECT_EQ(report.restarts, 1u);
+    EXPECT_EQ(report.boardsSolved, config.boards);
+    EXPECT_EQ(report.wordsFound, expectedWords(config));
+}
+
+TEST_F(SupervisorTest, RejectsInvalidConfig)
+{
+    SupervisorConfig config;
+    config.workers = 0;
+    EXPECT_THROW(runSupervisor(wordsTrie, config), std::invalid_argument);
+}